@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef GLOBAL_I18N_BIDI_ANALYZER_H
+#define GLOBAL_I18N_BIDI_ANALYZER_H
+
+#include <string>
+#include <vector>
+#include "unicode/ubidi.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+// A directional run of UTF-8 text, in logical order. start and end are byte offsets.
+struct BidiRun {
+    int32_t start;
+    int32_t end;
+    UBiDiLevel level;
+};
+
+/**
+ * Reusable text direction analyzer. Buffers and the UBiDi object are kept between calls, so one analyzer
+ * should be used for many strings on a single thread. Text without strong characters takes the direction
+ * of the locale given at construction.
+ */
+class BidiAnalyzer {
+public:
+    explicit BidiAnalyzer(const std::string &localeTag);
+    ~BidiAnalyzer();
+    BidiAnalyzer(const BidiAnalyzer &) = delete;
+    BidiAnalyzer &operator=(const BidiAnalyzer &) = delete;
+    UBiDiDirection GetBaseDirection(const std::string &text) const;
+    bool IsMixedDirection(const std::string &text);
+    bool GetRuns(const std::string &text, std::vector<BidiRun> &runs);
+
+private:
+    bool SetText(const std::string &text);
+    UBiDi *bidi = nullptr;
+    std::vector<UChar> buffer;
+    std::vector<int32_t> offsets;
+    bool localeRTL = false;
+};
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
+#endif
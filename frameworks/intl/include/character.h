@@ -16,6 +16,8 @@
 #define GLOBAL_I18N_CHARACTER_H
 #include <string>
 #include <map>
+#include <vector>
+#include "unicode/ubidi.h"
 #include "unicode/uchar.h"
 
 namespace OHOS {
@@ -30,6 +32,38 @@ bool IsLetter(const std::string &character);
 bool IsLowerCase(const std::string &character);
 bool IsUpperCase(const std::string &character);
 std::string GetType(const std::string &character);
+bool IsDigit(UChar32 character);
+bool IsSpaceChar(UChar32 character);
+bool IsWhiteSpace(UChar32 character);
+bool IsRTLCharacter(UChar32 character);
+bool IsIdeoGraphic(UChar32 character);
+bool IsLetter(UChar32 character);
+bool IsLowerCase(UChar32 character);
+bool IsUpperCase(UChar32 character);
+const char *GetType(UChar32 character);
+UChar32 GetFirstCodePoint(const std::string &character);
+
+// Flags returned by GetCharacterClasses, one bit for each of the predicates above.
+enum CharacterClass : uint8_t {
+    CHARACTER_CLASS_DIGIT = 1 << 0,
+    CHARACTER_CLASS_SPACE_CHAR = 1 << 1,
+    CHARACTER_CLASS_WHITE_SPACE = 1 << 2,
+    CHARACTER_CLASS_RTL = 1 << 3,
+    CHARACTER_CLASS_IDEOGRAPHIC = 1 << 4,
+    CHARACTER_CLASS_LETTER = 1 << 5,
+    CHARACTER_CLASS_LOWER_CASE = 1 << 6,
+    CHARACTER_CLASS_UPPER_CASE = 1 << 7,
+};
+uint8_t GetCharacterClasses(UChar32 character);
+// Appends one entry per code point of the UTF-8 text, ill-formed sequences count as U+FFFD.
+void GetCharacterClasses(const std::string &text, std::vector<uint8_t> &classes);
+// Appends one entry per UTF-16 code unit, both units of a surrogate pair get the class of the pair.
+void GetCharacterClasses(const std::u16string &text, std::vector<uint8_t> &classes);
+bool ContainsRTLCharacter(const std::string &text);
+bool IsAllDigits(const std::string &text);
+int32_t CountIdeographs(const std::string &text);
+// Direction of the first L, R or AL character, UBIDI_NEUTRAL when there is none.
+UBiDiDirection GetFirstStrongDirection(const std::string &text);
 } // namespace I18n
 } // namespace Global
 } // namespace OHOS
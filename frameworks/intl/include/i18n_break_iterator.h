@@ -15,14 +15,24 @@
 #ifndef OHOS_GLOBAL_I18N_BREAKITERATOR_H
 #define OHOS_GLOBAL_I18N_BREAKITERATOR_H
 
+#include <string>
+#include <vector>
 #include "unicode/brkiter.h"
 
 namespace OHOS {
 namespace Global {
 namespace I18n {
+enum BreakIteratorType {
+    LINE_BREAK,
+    WORD_BREAK,
+    SENTENCE_BREAK,
+    CHARACTER_BREAK
+};
+
 class I18nBreakIterator {
 public:
     explicit I18nBreakIterator(std::string lcoaleTag);
+    I18nBreakIterator(const std::string &localeTag, BreakIteratorType type);
     virtual ~I18nBreakIterator();
     int32_t current();
     int32_t first();
@@ -32,11 +42,28 @@ public:
     int32_t previous();
     int32_t following(int32_t offset);
     void setText(const char* text);
+    bool SetUTF8Text(const char *text, int32_t length);
+    bool SetUTF16Text(const char16_t *text, int32_t length);
     void getText(std::string &str);
     bool isBoundary(int32_t offset);
+    void GetAllBoundaries(std::vector<int32_t> &boundaries);
+    void GetAllBoundaries(std::vector<int32_t> &boundaries, std::vector<int32_t> &ruleStatus);
 private:
+    enum TextMode {
+        COPIED_TEXT,
+        UTF8_TEXT,
+        UTF16_TEXT
+    };
+    bool SetUText(UText *text, TextMode mode);
+    static icu::BreakIterator *CreateInstance(const std::string &localeTag, BreakIteratorType type);
+    static icu::BreakIterator *CreatePrototype(const std::string &localeTag, BreakIteratorType type);
+    static constexpr size_t MAX_PROTOTYPE_COUNT = 16;
     icu::BreakIterator *iter = nullptr;
     icu::UnicodeString ftext = "";
+    TextMode textMode = COPIED_TEXT;
+    const char *utf8Text = nullptr;
+    const char16_t *utf16Text = nullptr;
+    int32_t textLength = 0;
     static constexpr int32_t OFF_BOUND = -1;
 };
 } // namespace I18n
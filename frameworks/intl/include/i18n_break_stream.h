@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef GLOBAL_I18N_BREAK_STREAM_H
+#define GLOBAL_I18N_BREAK_STREAM_H
+
+#include <cstdint>
+#include <string>
+#include "i18n_break_iterator.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+/**
+ * Incremental boundary finder for UTF-8 text that arrives in chunks, such as a book chapter read from disk.
+ * Boundaries are reported as byte offsets from the start of the whole stream as soon as enough text follows
+ * them, so the first lines can be laid out before the rest of the text is loaded. Text before the last
+ * reported boundary is dropped, so memory use depends on the chunk size rather than the size of the stream.
+ * To resume from a saved GetPosition(), call Reset with it and append the text that starts there.
+ */
+class I18nBreakStream {
+public:
+    explicit I18nBreakStream(const std::string &localeTag, BreakIteratorType type = LINE_BREAK);
+    ~I18nBreakStream() = default;
+    void Append(const char *text, size_t length);
+    void Finish();
+    bool NextBoundary(int64_t &offset);
+    int64_t GetPosition() const;
+    void Reset(int64_t position);
+
+    // A boundary is only reported when at least this many bytes follow it, or the stream is finished.
+    static constexpr int32_t MIN_LOOKAHEAD = 256;
+    // Text without a reportable boundary is broken at the end of the buffer once it exceeds this size.
+    static constexpr int32_t MAX_BUFFERED = 65536;
+
+private:
+    void Compact();
+    static constexpr int32_t COMPACT_THRESHOLD = 4096;
+    I18nBreakIterator iterator;
+    std::string buffer;
+    int64_t bufferStart = 0;
+    int32_t cursor = 0;
+    bool textChanged = false;
+    bool finished = false;
+};
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
+#endif
@@ -15,6 +15,10 @@
 #ifndef OHOS_GLOBAL_I18N_CALENDAR_H
 #define OHOS_GLOBAL_I18N_CALENDAR_H
 
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
 #include "unicode/ucal.h"
 #include "unicode/calendar.h"
 
@@ -37,6 +41,8 @@ enum CalendarType {
     UNDEFINED
 };
 
+struct MonthStartTable;
+
 class I18nCalendar {
 public:
     explicit I18nCalendar(std::string localeTag);
@@ -54,11 +60,39 @@ public:
     int32_t GetFirstDayOfWeek(void);
     bool IsWeekend(int64_t date, UErrorCode &status);
     bool IsWeekend(void);
+    bool GetWeekendBitmap(int64_t date, int32_t days, std::vector<uint8_t> &bitmap);
     std::string GetDisplayName(std::string &displayLocale);
+    bool GetFields(double time, const UCalendarDateFields *fields, int32_t *out, size_t count);
+    bool GetMonthGrid(int32_t year, int32_t month, const UCalendarDateFields *fields, size_t count,
+        std::vector<int32_t> &cells);
+    static bool Preload(const std::string &localeTag, CalendarType type);
+    static const int32_t MONTH_GRID_CELLS = 42;
+    static const int32_t DAYS_PER_WEEK = 7;
+
 private:
     icu::Calendar *calendar_;
+    icu::Calendar *fieldCalendar_ = nullptr;
+    icu::Calendar *GetFieldCalendar();
+    void ResetFieldCalendar();
+    bool LoadWeekendRules();
+    bool IsLocalWeekend(int64_t localMillis) const;
+    bool weekendLoaded_ = false;
+    UCalendarWeekdayType dayTypes_[DAYS_PER_WEEK];
+    int32_t weekendTransitions_[DAYS_PER_WEEK];
     void InitCalendar(const icu::Locale &locale, CalendarType type);
     void InitCalendar2(const icu::Locale &locale, CalendarType type);
+    bool ClonePrototype(const std::string &key);
+    void SavePrototype(const std::string &key);
+    static std::string GetPrototypeKey(const icu::Locale &locale, CalendarType type);
+    bool LoadMonthTable(bool build);
+    bool GetTableFields(double time, const UCalendarDateFields *fields, int32_t *out, size_t count);
+    static std::shared_ptr<const MonthStartTable> BuildMonthTable(const icu::Calendar &prototype);
+    // Lunar calendars convert days between 1900 and 2100 through a table of month starts shared by the process.
+    // Building it takes up to a few hundred milliseconds, so it is only built by Preload, which JS reaches through
+    // the asynchronous i18n.preloadCalendar; until then GetFields uses ICU.
+    std::shared_ptr<const MonthStartTable> monthTable_ = nullptr;
+    int32_t monthTableSlot_ = -1;
+    bool monthTableChecked_ = false;
 };
 } // namespace I18n
 } // namespace Global
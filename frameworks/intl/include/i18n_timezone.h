@@ -15,17 +15,31 @@
 #ifndef OHOS_GLOBAL_I18N_TIMEZONE_H
 #define OHOS_GLOBAL_I18N_TIMEZONE_H
 
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 #include "unicode/timezone.h"
 
 namespace OHOS {
 namespace Global {
 namespace I18n {
+// A row of a time zone picker. offset is the total offset from GMT in milliseconds at the requested date.
+struct TimeZoneItem {
+    std::string zoneID;
+    std::string country;
+    int32_t offset;
+    std::string displayName;
+    std::string city;
+};
+
 class I18nTimeZone {
 public:
     I18nTimeZone(std::string zoneID);
     ~I18nTimeZone();
     int32_t GetOffset(double date);
+    void GetOffsets(const double *dates, int32_t *offsets, size_t count);
+    bool SetTransitionWindow(int32_t startYear, int32_t endYear);
     int32_t GetRawOffset();
     std::string GetID();
     std::string GetDisplayName();
@@ -33,10 +47,36 @@ public:
     std::string GetDisplayName(std::string localeStr);
     std::string GetDisplayName(std::string localeStr, bool isDST);
     static std::unique_ptr<I18nTimeZone> CreateInstance(std::string zoneID);
+    static bool GetDisplayNames(const std::string &localeStr, bool isDST,
+        std::vector<std::pair<std::string, std::string>> &names);
+    static bool GetTimeZoneItems(const std::string &localeStr, double date, std::vector<TimeZoneItem> &items);
 
 private:
-    icu::TimeZone* GetTimeZone();
-    icu::TimeZone *timezone;
+    const icu::TimeZone* GetTimeZone();
+    static std::shared_ptr<const icu::TimeZone> GetSharedTimeZone(const std::string &zoneID);
+    static std::string GetCachedDisplayName(const icu::TimeZone &zone, const std::string &zoneID,
+        const icu::Locale &locale, bool isDST);
+    static bool LoadTimeZoneItems(const std::string &localeStr, std::vector<TimeZoneItem> &items);
+    int32_t GetIcuOffset(double date);
+    bool LoadTransitions();
+    size_t FindSegment(double date) const;
+    // Zones created from an ID are shared by all instances and never modified.
+    std::shared_ptr<const icu::TimeZone> timezone;
+    std::string id;
+    // Offsets between startYear and endYear are read from a table of the zone's transitions, which is built by
+    // the batch API or once GetOffset has been called TRANSITIONS_THRESHOLD times.
+    static constexpr int32_t DEFAULT_START_YEAR = 1970;
+    static constexpr int32_t DEFAULT_END_YEAR = 2050;
+    static constexpr int32_t TRANSITIONS_THRESHOLD = 16;
+    int32_t startYear = DEFAULT_START_YEAR;
+    int32_t endYear = DEFAULT_END_YEAR;
+    int32_t offsetCalls = 0;
+    bool transitionsLoaded = false;
+    double windowStart = 0;
+    double windowEnd = 0;
+    // transitionOffsets[i] is in effect from transitions[i - 1] until transitions[i].
+    std::vector<double> transitions;
+    std::vector<int32_t> transitionOffsets;
 };
 } // namespace I18n
 } // namespace Global
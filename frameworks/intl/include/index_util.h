@@ -15,6 +15,7 @@
 #ifndef GLOBAL_I18N_INDEX_UTIL_H
 #define GLOBAL_I18N_INDEX_UTIL_H
 
+#include <memory>
 #include <string>
 #include <vector>
 #include "unicode/alphaindex.h"
@@ -28,10 +29,25 @@ public:
     ~IndexUtil();
     std::vector<std::string> GetIndexList();
     void AddLocale(const std::string &localeTag);
-    std::string GetIndex(const std::string &String);
+    const std::string &GetIndex(const std::string &String);
+    bool AssignBuckets(const std::vector<std::string> &names, std::vector<int32_t> &buckets);
+    bool GroupByBucket(const std::vector<std::string> &names, std::vector<std::vector<int32_t>> &groups);
 
 private:
+    bool LoadLabels();
+    bool LoadImmutableIndex();
+    void AssignRange(const std::vector<std::string> &names, std::vector<int32_t> &buckets, size_t begin,
+        size_t end) const;
+    // Lists shorter than this are bucketed on the calling thread.
+    static constexpr size_t PARALLEL_THRESHOLD = 8192;
+    static constexpr unsigned int MAX_THREADS = 4;
     std::unique_ptr<icu::AlphabeticIndex> index;
+    // Bucket labels by bucket index, rebuilt on first use after construction or AddLocale.
+    std::vector<std::string> labels;
+    bool labelsLoaded = false;
+    std::string emptyLabel;
+    // Thread safe snapshot of the buckets used by AssignBuckets, rebuilt on first use after AddLocale.
+    std::unique_ptr<icu::AlphabeticIndex::ImmutableIndex> immutableIndex;
 };
 } // namespace I18n
 } // namespace Global
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef GLOBAL_I18N_LIKELY_SUBTAGS_H
+#define GLOBAL_I18N_LIKELY_SUBTAGS_H
+
+#include <atomic>
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+/**
+ * Process wide memo of icu::Locale::addLikelySubtags and icu::Locale::minimizeSubtags results. Keys and results
+ * are icu base names, such as "zh_TW" -> "zh_Hant_TW". Each table holds at most MAX_CACHE_SIZE entries and is
+ * dropped as a whole when it is full.
+ */
+class LikelySubtags {
+public:
+    static bool Maximize(const std::string &baseName, std::string &result);
+    static bool Minimize(const std::string &baseName, std::string &result);
+    static void GetStatistics(uint64_t &hits, uint64_t &misses);
+    static void Clear();
+    static const size_t MAX_CACHE_SIZE = 1024;
+
+private:
+    static bool Lookup(const std::string &baseName, bool maximize, std::string &result);
+    static std::shared_mutex cacheMutex;
+    static std::unordered_map<std::string, std::string> maximizeCache;
+    static std::unordered_map<std::string, std::string> minimizeCache;
+    static std::atomic<uint64_t> hitCount;
+    static std::atomic<uint64_t> missCount;
+};
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
+#endif
@@ -15,11 +15,13 @@
 #ifndef OHOS_GLOBAL_I18N_LOCALE_CONFIG_H
 #define OHOS_GLOBAL_I18N_LOCALE_CONFIG_H
 
+#include <mutex>
 #include <vector>
 #include <set>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 
 namespace OHOS {
 namespace Global {
@@ -42,6 +44,14 @@ public:
         bool sentenceCase);
     static std::string GetDisplayRegion(const std::string &region, const std::string &displayLocale,
         bool sentenceCase);
+    static std::vector<std::string> GetDisplayLanguages(const std::vector<std::string> &languages,
+        const std::string &displayLocale, bool sentenceCase);
+    static std::vector<std::string> GetDisplayRegions(const std::vector<std::string> &regions,
+        const std::string &displayLocale, bool sentenceCase);
+    static void GetSortedDisplayLanguages(const std::vector<std::string> &languages, const std::string &displayLocale,
+        bool sentenceCase, std::vector<std::pair<std::string, std::string>> &result);
+    static void GetSortedDisplayRegions(const std::vector<std::string> &regions, const std::string &displayLocale,
+        bool sentenceCase, std::vector<std::pair<std::string, std::string>> &result);
     static bool IsRTL(const std::string &locale);
     static std::string GetValidLocale(const std::string &localeTag);
     static bool Is24HourClock();
@@ -79,8 +89,9 @@ private:
     static const std::unordered_set<std::string>& GetForbiddenRegions();
     static const std::unordered_set<std::string>& GetSupportedRegions();
     static void GetCountriesFromSim(std::vector<std::string> &simCountries);
-    static void GetRelatedLocales(std::unordered_set<std::string> &relatedLocales,
-        const std::vector<std::string> countries);
+    static bool IsSuggestedInCountries(const std::string &language, const std::vector<std::string> &countries);
+    static void InitializeSuggestedLanguages();
+    static std::string GetSuggestedMainLanguage(const std::string &language);
     static std::string GetRegionChangeLocale(const std::string &languageTag, const std::string &region);
     static void GetListFromFile(const char *path, const char *resourceName, std::unordered_set<std::string> &ret);
     static void Expunge(std::unordered_set<std::string> &src, const std::unordered_set<std::string> &another);
@@ -89,6 +100,12 @@ private:
     static std::unordered_set<std::string> supportedRegions;
     static std::unordered_set<std::string> whiteLanguages;
     static std::unordered_map<std::string, std::string> dialectMap;
+    // supported region -> main languages of the supported locales of that region, limited to white languages
+    static std::unordered_map<std::string, std::unordered_set<std::string>> suggestedLanguages;
+    static std::once_flag suggestedLanguagesFlag;
+    static std::unordered_map<std::string, std::string> mainLanguages;
+    static std::mutex mainLanguagesMutex;
+    static constexpr size_t MAIN_LANGUAGES_CACHE_SIZE = 512;
     static std::set<std::string> validCaTag;
     static std::set<std::string> validCoTag;
     static std::set<std::string> validKnTag;
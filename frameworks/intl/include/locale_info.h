@@ -16,7 +16,10 @@
 #define OHOS_GLOBAL_I18N_LOCALE_INFO_H
 
 #include <map>
+#include <memory>
 #include <set>
+#include <string>
+#include <vector>
 #include "unicode/locid.h"
 #include "unicode/localebuilder.h"
 #include "unicode/stringpiece.h"
@@ -42,39 +45,47 @@ public:
     std::string GetNumeric() const;
     std::string GetCaseFirst() const;
     std::string ToString() const;
-    icu::Locale GetLocale() const;
+    const icu::Locale &GetLocale() const;
     icu::Locale GetLocaleTag() const;
     static const uint32_t SCRIPT_LEN = 4;
     static const uint32_t REGION_LEN = 2;
-    static std::set<std::string> allValidLocales;
-    static std::set<std::string> GetValidLocales();
+    static bool IsValidLanguage(const char *language);
 private:
-    std::string language;
-    std::string region;
-    std::string script;
-    std::string baseName;
-    std::string calendar;
-    std::string collation;
-    std::string hourCycle;
-    std::string numberingSystem;
-    std::string numeric;
-    std::string caseFirst;
+    // Unicode extension keys, in the order they are emitted into finalLocaleTag.
+    enum ExtensionKey : uint8_t {
+        HOUR_CYCLE,
+        NUMBERING_SYSTEM,
+        CALENDAR,
+        COLLATION,
+        CASE_FIRST,
+        NUMERIC,
+        EXTENSION_COUNT
+    };
+    // Language, script and region are kept as packed ASCII codes, extension values as ids into a table
+    // of well-known values; anything else falls back to extraSubtags. Strings are only built in getters.
     std::string finalLocaleTag;
-    std::string localeTag;
-    icu::Locale locale;
-    std::string calendarTag = "-ca-";
-    std::string collationTag = "-co-";
-    std::string hourCycleTag = "-hc-";
-    std::string numberingSystemTag = "-nu-";
-    std::string numericTag = "-kn-";
-    std::string caseFirstTag = "-kf-";
+    // Built from finalLocaleTag on the first GetLocale, most callers never need it.
+    mutable std::unique_ptr<icu::Locale> locale;
+    std::vector<std::string> extraSubtags;
+    uint64_t languageCode = 0;
+    uint32_t scriptCode = 0;
+    uint32_t regionCode = 0;
+    uint8_t extensions[EXTENSION_COUNT] = { 0 };
+    uint8_t variantId = 0;
+    bool fullBaseName = false;
     static bool icuInitialized;
     static bool Init();
     static const uint32_t CONFIG_TAG_LEN = 4;
-    std::map<std::string, std::string> configs;
-    void ComputeFinalLocaleTag(const std::string &localeTag);
-    void ParseConfigs();
+    void ComputeFinalLocaleTag(const std::string &localeTag, const std::map<std::string, std::string> &configs);
+    void ParseConfigs(const std::map<std::string, std::string> &configs, std::string &script, std::string &region);
     void ParseLocaleTag(const std::string &localeTag);
+    void SetSubtags(const icu::Locale &locale);
+    void SetExtension(ExtensionKey key, const std::string &value);
+    std::string GetExtension(ExtensionKey key) const;
+    uint8_t InternSubtag(const std::string &value);
+    std::string GetSubtag(uint8_t id) const;
+    std::string GetIcuBaseName() const;
+    std::string ComputeLikelyTag(bool maximize);
 };
 } // namespace I18n
 } // namespace Global
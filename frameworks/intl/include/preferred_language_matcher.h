@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef GLOBAL_I18N_PREFERRED_LANGUAGE_MATCHER_H
+#define GLOBAL_I18N_PREFERRED_LANGUAGE_MATCHER_H
+
+#include <string>
+#include <vector>
+#include "unicode/locid.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+/**
+ * Matches resource locales against a preferred language list, which is parsed and maximized once on
+ * construction, typically from PreferredLanguage::GetPreferredLanguageList().
+ */
+class PreferredLanguageMatcher {
+public:
+    explicit PreferredLanguageMatcher(const std::vector<std::string> &preferredLanguages);
+    ~PreferredLanguageMatcher();
+    // Index in resourceLocales of the best match, earlier preferred languages win. -1 if nothing matches.
+    int32_t GetBestMatch(const std::vector<std::string> &resourceLocales) const;
+    size_t GetPreferredCount() const;
+
+private:
+    std::vector<icu::Locale> preferredLocales;
+};
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
+#endif
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "bidi_analyzer.h"
+#include "character.h"
+#include "locale_config.h"
+#include "unicode/utf16.h"
+#include "unicode/utf8.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+BidiAnalyzer::BidiAnalyzer(const std::string &localeTag)
+{
+    localeRTL = !localeTag.empty() && LocaleConfig::IsRTL(localeTag);
+    bidi = ubidi_open();
+}
+
+BidiAnalyzer::~BidiAnalyzer()
+{
+    if (bidi) {
+        ubidi_close(bidi);
+    }
+}
+
+UBiDiDirection BidiAnalyzer::GetBaseDirection(const std::string &text) const
+{
+    UBiDiDirection direction = GetFirstStrongDirection(text);
+    if (direction == UBIDI_NEUTRAL) {
+        return localeRTL ? UBIDI_RTL : UBIDI_LTR;
+    }
+    return direction;
+}
+
+bool BidiAnalyzer::IsMixedDirection(const std::string &text)
+{
+    if (!SetText(text)) {
+        return false;
+    }
+    return ubidi_getDirection(bidi) == UBIDI_MIXED;
+}
+
+bool BidiAnalyzer::GetRuns(const std::string &text, std::vector<BidiRun> &runs)
+{
+    runs.clear();
+    if (!SetText(text)) {
+        return false;
+    }
+    int32_t length = static_cast<int32_t>(buffer.size());
+    int32_t logicalStart = 0;
+    while (logicalStart < length) {
+        int32_t logicalLimit = 0;
+        UBiDiLevel level = 0;
+        ubidi_getLogicalRun(bidi, logicalStart, &logicalLimit, &level);
+        if (logicalLimit <= logicalStart) {
+            return false;
+        }
+        runs.push_back({ offsets[logicalStart], offsets[logicalLimit], level });
+        logicalStart = logicalLimit;
+    }
+    return true;
+}
+
+// Converts text to UTF-16 and records the UTF-8 offset of every UTF-16 unit, plus the end offset.
+bool BidiAnalyzer::SetText(const std::string &text)
+{
+    if (!bidi) {
+        return false;
+    }
+    buffer.clear();
+    offsets.clear();
+    const char *data = text.data();
+    int32_t length = static_cast<int32_t>(text.length());
+    int32_t offset = 0;
+    while (offset < length) {
+        int32_t start = offset;
+        UChar32 char32 = 0;
+        U8_NEXT(data, offset, length, char32);
+        if (char32 < 0) {
+            char32 = 0xFFFD; // ill-formed input is read as U+FFFD
+        }
+        if (U_IS_BMP(char32)) {
+            buffer.push_back(static_cast<UChar>(char32));
+            offsets.push_back(start);
+        } else {
+            buffer.push_back(U16_LEAD(char32));
+            buffer.push_back(U16_TRAIL(char32));
+            offsets.push_back(start);
+            offsets.push_back(start);
+        }
+    }
+    offsets.push_back(length);
+    UErrorCode status = U_ZERO_ERROR;
+    UBiDiLevel paraLevel = localeRTL ? UBIDI_DEFAULT_RTL : UBIDI_DEFAULT_LTR;
+    ubidi_setPara(bidi, buffer.data(), static_cast<int32_t>(buffer.size()), paraLevel, nullptr, &status);
+    return U_SUCCESS(status);
+}
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
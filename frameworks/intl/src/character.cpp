@@ -13,121 +13,324 @@
  * limitations under the License.
  */
 #include "character.h"
-#include <set>
-#include "unicode/unistr.h"
+#include <array>
+#include <cstring>
+#include "unicode/utf8.h"
 
 namespace OHOS {
 namespace Global {
 namespace I18n {
-static std::set<UCharDirection> RTLDirectionSet = {
-    U_RIGHT_TO_LEFT,
-    U_RIGHT_TO_LEFT_ARABIC,
-    U_RIGHT_TO_LEFT_EMBEDDING,
-    U_RIGHT_TO_LEFT_OVERRIDE,
-    U_RIGHT_TO_LEFT_ISOLATE
+static constexpr uint32_t RTL_DIRECTION_MASK = (1U << U_RIGHT_TO_LEFT) | (1U << U_RIGHT_TO_LEFT_ARABIC) |
+    (1U << U_RIGHT_TO_LEFT_EMBEDDING) | (1U << U_RIGHT_TO_LEFT_OVERRIDE) | (1U << U_RIGHT_TO_LEFT_ISOLATE);
+static_assert(U_CHAR_DIRECTION_COUNT <= 32, "RTL_DIRECTION_MASK needs a bit per direction"); // 32 bits in the mask
+
+// indexed by UCharCategory, U_GENERAL_OTHER_TYPES shares 0 with U_UNASSIGNED
+static constexpr const char *CATEGORY_NAMES[] = {
+    "U_UNASSIGNED",
+    "U_UPPERCASE_LETTER",
+    "U_LOWERCASE_LETTER",
+    "U_TITLECASE_LETTER",
+    "U_MODIFIER_LETTER",
+    "U_OTHER_LETTER",
+    "U_NON_SPACING_MARK",
+    "U_ENCLOSING_MARK",
+    "U_COMBINING_SPACING_MARK",
+    "U_DECIMAL_DIGIT_NUMBER",
+    "U_LETTER_NUMBER",
+    "U_OTHER_NUMBER",
+    "U_SPACE_SEPARATOR",
+    "U_LINE_SEPARATOR",
+    "U_PARAGRAPH_SEPARATOR",
+    "U_CONTROL_CHAR",
+    "U_FORMAT_CHAR",
+    "U_PRIVATE_USE_CHAR",
+    "U_SURROGATE",
+    "U_DASH_PUNCTUATION",
+    "U_START_PUNCTUATION",
+    "U_END_PUNCTUATION",
+    "U_CONNECTOR_PUNCTUATION",
+    "U_OTHER_PUNCTUATION",
+    "U_MATH_SYMBOL",
+    "U_CURRENCY_SYMBOL",
+    "U_MODIFIER_SYMBOL",
+    "U_OTHER_SYMBOL",
+    "U_INITIAL_PUNCTUATION",
+    "U_FINAL_PUNCTUATION",
+    "U_CHAR_CATEGORY_COUNT",
 };
+static_assert(sizeof(CATEGORY_NAMES) / sizeof(CATEGORY_NAMES[0]) == U_CHAR_CATEGORY_COUNT + 1,
+    "CATEGORY_NAMES must cover every UCharCategory");
+
+UChar32 GetFirstCodePoint(const std::string &character)
+{
+    if (character.empty() || character[0] == '\0') {
+        return 0xFFFF; // 0xFFFF is what icu::UnicodeString::char32At returns for an empty string
+    }
+    int32_t offset = 0;
+    UChar32 char32 = 0;
+    U8_NEXT(character.data(), offset, static_cast<int32_t>(character.length()), char32);
+    return (char32 < 0) ? 0xFFFD : char32; // ill-formed input is read as U+FFFD
+}
+
+bool IsDigit(UChar32 character)
+{
+    return u_isdigit(character);
+}
+
+bool IsSpaceChar(UChar32 character)
+{
+    return u_isJavaSpaceChar(character);
+}
+
+bool IsWhiteSpace(UChar32 character)
+{
+    return u_isWhitespace(character);
+}
+
+bool IsRTLCharacter(UChar32 character)
+{
+    return (RTL_DIRECTION_MASK & (1U << u_charDirection(character))) != 0;
+}
+
+bool IsIdeoGraphic(UChar32 character)
+{
+    return u_hasBinaryProperty(character, UCHAR_IDEOGRAPHIC);
+}
+
+bool IsLetter(UChar32 character)
+{
+    return u_isalpha(character);
+}
+
+bool IsLowerCase(UChar32 character)
+{
+    return u_islower(character);
+}
+
+bool IsUpperCase(UChar32 character)
+{
+    return u_isupper(character);
+}
+
+const char *GetType(UChar32 character)
+{
+    return CATEGORY_NAMES[u_charType(character)];
+}
 
 bool IsDigit(const std::string &character)
 {
-    icu::UnicodeString unicodeString(character.c_str());
-    UChar32 char32 = unicodeString.char32At(0);
-    return u_isdigit(char32);
+    return IsDigit(GetFirstCodePoint(character));
 }
 
 bool IsSpaceChar(const std::string &character)
 {
-    icu::UnicodeString unicodeString(character.c_str());
-    UChar32 char32 = unicodeString.char32At(0);
-    return u_isJavaSpaceChar(char32);
+    return IsSpaceChar(GetFirstCodePoint(character));
 }
 
 bool IsWhiteSpace(const std::string &character)
 {
-    icu::UnicodeString unicodeString(character.c_str());
-    UChar32 char32 = unicodeString.char32At(0);
-    return u_isWhitespace(char32);
+    return IsWhiteSpace(GetFirstCodePoint(character));
 }
 
 bool IsRTLCharacter(const std::string &character)
 {
-    icu::UnicodeString unicodeString(character.c_str());
-    UChar32 char32 = unicodeString.char32At(0);
-    UCharDirection direction = u_charDirection(char32);
-    if (RTLDirectionSet.find(direction) != RTLDirectionSet.end()) {
-        return true;
-    }
-    return false;
+    return IsRTLCharacter(GetFirstCodePoint(character));
 }
 
 bool IsIdeoGraphic(const std::string &character)
 {
-    icu::UnicodeString unicodeString(character.c_str());
-    UChar32 char32 = unicodeString.char32At(0);
-    return u_hasBinaryProperty(char32, UCHAR_IDEOGRAPHIC);
+    return IsIdeoGraphic(GetFirstCodePoint(character));
 }
 
 bool IsLetter(const std::string &character)
 {
-    icu::UnicodeString unicodeString(character.c_str());
-    UChar32 char32 = unicodeString.char32At(0);
-    return isalpha(char32);
+    return IsLetter(GetFirstCodePoint(character));
 }
 
 bool IsLowerCase(const std::string &character)
 {
-    icu::UnicodeString unicodeString(character.c_str());
-    UChar32 char32 = unicodeString.char32At(0);
-    return u_islower(char32);
+    return IsLowerCase(GetFirstCodePoint(character));
 }
 
 bool IsUpperCase(const std::string &character)
 {
-    icu::UnicodeString unicodeString(character.c_str());
-    UChar32 char32 = unicodeString.char32At(0);
-    return u_isupper(char32);
-}
-
-std::map<UCharCategory, std::string> categoryMap = {
-    { U_UNASSIGNED, "U_UNASSIGNED" },
-    { U_GENERAL_OTHER_TYPES, "U_GENERAL_OTHER_TYPES" },
-    { U_UPPERCASE_LETTER, "U_UPPERCASE_LETTER" },
-    { U_LOWERCASE_LETTER, "U_LOWERCASE_LETTER" },
-    { U_TITLECASE_LETTER, "U_TITLECASE_LETTER" },
-    { U_MODIFIER_LETTER, "U_MODIFIER_LETTER" },
-    { U_OTHER_LETTER, "U_OTHER_LETTER" },
-    { U_NON_SPACING_MARK, "U_NON_SPACING_MARK" },
-    { U_ENCLOSING_MARK, "U_ENCLOSING_MARK" },
-    { U_COMBINING_SPACING_MARK, "U_COMBINING_SPACING_MARK" },
-    { U_DECIMAL_DIGIT_NUMBER, "U_DECIMAL_DIGIT_NUMBER" },
-    { U_LETTER_NUMBER, "U_LETTER_NUMBER" },
-    { U_OTHER_NUMBER, "U_OTHER_NUMBER" },
-    { U_SPACE_SEPARATOR, "U_SPACE_SEPARATOR" },
-    { U_LINE_SEPARATOR, "U_LINE_SEPARATOR" },
-    { U_PARAGRAPH_SEPARATOR, "U_PARAGRAPH_SEPARATOR" },
-    { U_CONTROL_CHAR, "U_CONTROL_CHAR" },
-    { U_FORMAT_CHAR, "U_FORMAT_CHAR" },
-    { U_PRIVATE_USE_CHAR, "U_PRIVATE_USE_CHAR" },
-    { U_SURROGATE, "U_SURROGATE" },
-    { U_DASH_PUNCTUATION, "U_DASH_PUNCTUATION" },
-    { U_START_PUNCTUATION, "U_START_PUNCTUATION" },
-    { U_END_PUNCTUATION, "U_END_PUNCTUATION" },
-    { U_CONNECTOR_PUNCTUATION, "U_CONNECTOR_PUNCTUATION" },
-    { U_OTHER_PUNCTUATION, "U_OTHER_PUNCTUATION" },
-    { U_MATH_SYMBOL, "U_MATH_SYMBOL" },
-    { U_CURRENCY_SYMBOL, "U_CURRENCY_SYMBOL" },
-    { U_MODIFIER_SYMBOL, "U_MODIFIER_SYMBOL" },
-    { U_OTHER_SYMBOL, "U_OTHER_SYMBOL" },
-    { U_INITIAL_PUNCTUATION, "U_INITIAL_PUNCTUATION" },
-    { U_FINAL_PUNCTUATION, "U_FINAL_PUNCTUATION" },
-    { U_CHAR_CATEGORY_COUNT, "U_CHAR_CATEGORY_COUNT" },
-};
+    return IsUpperCase(GetFirstCodePoint(character));
+}
 
 std::string GetType(const std::string &character)
 {
-    icu::UnicodeString unicodeString(character.c_str());
-    UChar32 char32 = unicodeString.char32At(0);
-    int8_t category = u_charType(char32);
-    return categoryMap[UCharCategory(category)];
+    return GetType(GetFirstCodePoint(character));
+}
+
+uint8_t GetCharacterClasses(UChar32 character)
+{
+    uint8_t classes = 0;
+    classes |= IsDigit(character) ? CHARACTER_CLASS_DIGIT : 0;
+    classes |= IsSpaceChar(character) ? CHARACTER_CLASS_SPACE_CHAR : 0;
+    classes |= IsWhiteSpace(character) ? CHARACTER_CLASS_WHITE_SPACE : 0;
+    classes |= IsRTLCharacter(character) ? CHARACTER_CLASS_RTL : 0;
+    classes |= IsIdeoGraphic(character) ? CHARACTER_CLASS_IDEOGRAPHIC : 0;
+    classes |= IsLetter(character) ? CHARACTER_CLASS_LETTER : 0;
+    classes |= IsLowerCase(character) ? CHARACTER_CLASS_LOWER_CASE : 0;
+    classes |= IsUpperCase(character) ? CHARACTER_CLASS_UPPER_CASE : 0;
+    return classes;
+}
+
+static constexpr size_t ASCII_COUNT = 0x80;
+
+static const std::array<uint8_t, ASCII_COUNT> &GetAsciiClasses()
+{
+    static const std::array<uint8_t, ASCII_COUNT> asciiClasses = [] {
+        std::array<uint8_t, ASCII_COUNT> classes {};
+        for (size_t i = 0; i < ASCII_COUNT; ++i) {
+            classes[i] = GetCharacterClasses(static_cast<UChar32>(i));
+        }
+        return classes;
+    }();
+    return asciiClasses;
+}
+
+// Returns the offset of the first non ASCII byte at or after offset, testing 8 bytes at a time.
+static int32_t SkipAscii(const char *text, int32_t offset, int32_t length)
+{
+    constexpr uint64_t highBits = 0x8080808080808080ULL;
+    while (offset + static_cast<int32_t>(sizeof(uint64_t)) <= length) {
+        uint64_t word = 0;
+        memcpy(&word, text + offset, sizeof(uint64_t));
+        if ((word & highBits) != 0) {
+            break;
+        }
+        offset += static_cast<int32_t>(sizeof(uint64_t));
+    }
+    while (offset < length && static_cast<uint8_t>(text[offset]) < ASCII_COUNT) {
+        ++offset;
+    }
+    return offset;
+}
+
+static UChar32 NextCodePoint(const char *text, int32_t &offset, int32_t length)
+{
+    UChar32 char32 = 0;
+    U8_NEXT(text, offset, length, char32);
+    return (char32 < 0) ? 0xFFFD : char32;
+}
+
+void GetCharacterClasses(const std::string &text, std::vector<uint8_t> &classes)
+{
+    const std::array<uint8_t, ASCII_COUNT> &asciiClasses = GetAsciiClasses();
+    const char *data = text.data();
+    int32_t length = static_cast<int32_t>(text.length());
+    classes.reserve(classes.size() + text.length());
+    int32_t offset = 0;
+    while (offset < length) {
+        uint8_t byte = static_cast<uint8_t>(data[offset]);
+        if (byte < ASCII_COUNT) {
+            classes.push_back(asciiClasses[byte]);
+            ++offset;
+            continue;
+        }
+        classes.push_back(GetCharacterClasses(NextCodePoint(data, offset, length)));
+    }
+}
+
+void GetCharacterClasses(const std::u16string &text, std::vector<uint8_t> &classes)
+{
+    const std::array<uint8_t, ASCII_COUNT> &asciiClasses = GetAsciiClasses();
+    const char16_t *data = text.data();
+    int32_t length = static_cast<int32_t>(text.length());
+    classes.reserve(classes.size() + text.length());
+    int32_t offset = 0;
+    while (offset < length) {
+        if (data[offset] < ASCII_COUNT) {
+            classes.push_back(asciiClasses[data[offset]]);
+            ++offset;
+            continue;
+        }
+        int32_t start = offset;
+        UChar32 char32 = 0;
+        U16_NEXT(data, offset, length, char32);
+        classes.insert(classes.end(), offset - start, GetCharacterClasses(char32));
+    }
+}
+
+bool ContainsRTLCharacter(const std::string &text)
+{
+    const char *data = text.data();
+    int32_t length = static_cast<int32_t>(text.length());
+    int32_t offset = SkipAscii(data, 0, length);
+    while (offset < length) {
+        if (IsRTLCharacter(NextCodePoint(data, offset, length))) {
+            return true;
+        }
+        offset = SkipAscii(data, offset, length);
+    }
+    return false;
+}
+
+bool IsAllDigits(const std::string &text)
+{
+    if (text.empty()) {
+        return false;
+    }
+    const char *data = text.data();
+    int32_t length = static_cast<int32_t>(text.length());
+    int32_t offset = 0;
+    while (offset < length) {
+        uint8_t byte = static_cast<uint8_t>(data[offset]);
+        if (byte < ASCII_COUNT) {
+            if (byte < '0' || byte > '9') {
+                return false;
+            }
+            ++offset;
+            continue;
+        }
+        if (!IsDigit(NextCodePoint(data, offset, length))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int32_t CountIdeographs(const std::string &text)
+{
+    const char *data = text.data();
+    int32_t length = static_cast<int32_t>(text.length());
+    int32_t count = 0;
+    int32_t offset = SkipAscii(data, 0, length);
+    while (offset < length) {
+        if (IsIdeoGraphic(NextCodePoint(data, offset, length))) {
+            ++count;
+        }
+        offset = SkipAscii(data, offset, length);
+    }
+    return count;
+}
+
+UBiDiDirection GetFirstStrongDirection(const std::string &text)
+{
+    const std::array<uint8_t, ASCII_COUNT> &asciiClasses = GetAsciiClasses();
+    const char *data = text.data();
+    int32_t length = static_cast<int32_t>(text.length());
+    int32_t offset = 0;
+    while (offset < length) {
+        uint8_t byte = static_cast<uint8_t>(data[offset]);
+        if (byte < ASCII_COUNT) {
+            // ASCII letters are the only strong ASCII characters, and they are all L
+            if ((asciiClasses[byte] & CHARACTER_CLASS_LETTER) != 0) {
+                return UBIDI_LTR;
+            }
+            ++offset;
+            continue;
+        }
+        UCharDirection direction = u_charDirection(NextCodePoint(data, offset, length));
+        if (direction == U_LEFT_TO_RIGHT) {
+            return UBIDI_LTR;
+        }
+        if (direction == U_RIGHT_TO_LEFT || direction == U_RIGHT_TO_LEFT_ARABIC) {
+            return UBIDI_RTL;
+        }
+    }
+    return UBIDI_NEUTRAL;
 }
 } // namespace I18n
 } // namespace Global
@@ -42,7 +42,7 @@ DateTimeFormat::DateTimeFormat(const std::vector<std::string> &localeTags, std::
     for (size_t i = 0; i < localeTags.size(); i++) {
         std::string curLocale = localeTags[i];
         locale = Locale::forLanguageTag(StringPiece(curLocale), status);
-        if (LocaleInfo::allValidLocales.count(locale.getLanguage()) > 0) {
+        if (LocaleInfo::IsValidLanguage(locale.getLanguage())) {
             InitWithLocale(curLocale, configs);
             if (!dateFormat) {
                 delete localeInfo;
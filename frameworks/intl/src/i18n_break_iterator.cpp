@@ -14,14 +14,75 @@
  */
 
 #include "i18n_break_iterator.h"
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include "unicode/ustring.h"
+#include "unicode/utext.h"
 
 namespace OHOS {
 namespace Global {
 namespace I18n {
+// (locale tag, type) -> iterator handed out as clones, rule based iterators are expensive to build
+static std::map<std::pair<std::string, BreakIteratorType>, std::unique_ptr<icu::BreakIterator>> g_prototypes;
+static std::mutex g_prototypesMutex;
+// Rough number of text units between two boundaries, only used to size the boundary vectors up front.
+static constexpr int32_t AVERAGE_BOUNDARY_DISTANCE = 4;
+
 I18nBreakIterator::I18nBreakIterator(std::string localeTag)
+{
+    iter = CreateInstance(localeTag, LINE_BREAK);
+}
+
+I18nBreakIterator::I18nBreakIterator(const std::string &localeTag, BreakIteratorType type)
+{
+    iter = CreateInstance(localeTag, type);
+}
+
+icu::BreakIterator *I18nBreakIterator::CreatePrototype(const std::string &localeTag, BreakIteratorType type)
 {
     UErrorCode status = U_ZERO_ERROR;
-    iter = icu::BreakIterator::createLineInstance(localeTag.c_str(), status);
+    icu::Locale locale(localeTag.c_str());
+    icu::BreakIterator *prototype = nullptr;
+    switch (type) {
+        case WORD_BREAK:
+            prototype = icu::BreakIterator::createWordInstance(locale, status);
+            break;
+        case SENTENCE_BREAK:
+            prototype = icu::BreakIterator::createSentenceInstance(locale, status);
+            break;
+        case CHARACTER_BREAK:
+            prototype = icu::BreakIterator::createCharacterInstance(locale, status);
+            break;
+        default:
+            prototype = icu::BreakIterator::createLineInstance(locale, status);
+            break;
+    }
+    if (U_FAILURE(status)) {
+        delete prototype;
+        return nullptr;
+    }
+    return prototype;
+}
+
+icu::BreakIterator *I18nBreakIterator::CreateInstance(const std::string &localeTag, BreakIteratorType type)
+{
+    std::pair<std::string, BreakIteratorType> key(localeTag, type);
+    std::lock_guard<std::mutex> lock(g_prototypesMutex);
+    auto iter = g_prototypes.find(key);
+    if (iter == g_prototypes.end()) {
+        std::unique_ptr<icu::BreakIterator> prototype(CreatePrototype(localeTag, type));
+        if (!prototype) {
+            return nullptr;
+        }
+        if (g_prototypes.size() >= MAX_PROTOTYPE_COUNT) {
+            g_prototypes.clear();
+        }
+        iter = g_prototypes.emplace(key, std::move(prototype)).first;
+    }
+    return iter->second->clone();
 }
 
 I18nBreakIterator::~I18nBreakIterator()
@@ -92,13 +153,95 @@ void I18nBreakIterator::setText(const char *text)
     if (iter != nullptr) {
         ftext = text;
         iter->setText(ftext);
+        textMode = COPIED_TEXT;
+        utf8Text = nullptr;
+        utf16Text = nullptr;
+        textLength = ftext.length();
     }
 }
 
+// The text is not copied and must outlive the iterator or the next setText call. All offsets are byte offsets
+// into text. A negative length means text is NUL terminated. Returns false if the text could not be set.
+bool I18nBreakIterator::SetUTF8Text(const char *text, int32_t length)
+{
+    if (iter == nullptr || text == nullptr) {
+        return false;
+    }
+    if (length < 0) {
+        length = static_cast<int32_t>(strlen(text));
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    UText utext = UTEXT_INITIALIZER;
+    utext_openUTF8(&utext, text, length, &status);
+    if (U_FAILURE(status)) {
+        return false;
+    }
+    utf8Text = text;
+    utf16Text = nullptr;
+    textLength = length;
+    bool result = SetUText(&utext, UTF8_TEXT);
+    utext_close(&utext);
+    return result;
+}
+
+// The text is not copied and must outlive the iterator or the next setText call. All offsets are UTF-16 indices,
+// as with setText. A negative length means text is NUL terminated. Returns false if the text could not be set.
+bool I18nBreakIterator::SetUTF16Text(const char16_t *text, int32_t length)
+{
+    if (iter == nullptr || text == nullptr) {
+        return false;
+    }
+    if (length < 0) {
+        length = u_strlen(text);
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    UText utext = UTEXT_INITIALIZER;
+    utext_openUChars(&utext, text, length, &status);
+    if (U_FAILURE(status)) {
+        return false;
+    }
+    utf8Text = nullptr;
+    utf16Text = text;
+    textLength = length;
+    bool result = SetUText(&utext, UTF16_TEXT);
+    utext_close(&utext);
+    return result;
+}
+
+// The break iterator keeps its own shallow clone of text, so the caller may close it afterwards. If the text
+// cannot be set, the iterator is reset to empty text rather than left on text the caller may have released.
+bool I18nBreakIterator::SetUText(UText *text, TextMode mode)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    iter->setText(text, status);
+    ftext.remove();
+    if (U_FAILURE(status)) {
+        iter->setText(ftext);
+        textMode = COPIED_TEXT;
+        utf8Text = nullptr;
+        utf16Text = nullptr;
+        textLength = 0;
+        return false;
+    }
+    textMode = mode;
+    return true;
+}
+
 void I18nBreakIterator::getText(std::string &str)
 {
-    if (iter != nullptr) {
-        ftext.toUTF8String(str);
+    if (iter == nullptr) {
+        return;
+    }
+    switch (textMode) {
+        case UTF8_TEXT:
+            str.append(utf8Text, textLength);
+            break;
+        case UTF16_TEXT:
+            icu::UnicodeString(false, utf16Text, textLength).toUTF8String(str);
+            break;
+        default:
+            ftext.toUTF8String(str);
+            break;
     }
 }
 
@@ -109,6 +252,39 @@ bool I18nBreakIterator::isBoundary(int32_t offset)
     }
     return false;
 }
+
+// Collects every boundary from the start of the text. The current position is left unchanged.
+void I18nBreakIterator::GetAllBoundaries(std::vector<int32_t> &boundaries)
+{
+    boundaries.clear();
+    if (iter == nullptr) {
+        return;
+    }
+    int32_t position = iter->current();
+    boundaries.reserve(textLength / AVERAGE_BOUNDARY_DISTANCE + 1);
+    for (int32_t offset = iter->first(); offset != icu::BreakIterator::DONE; offset = iter->next()) {
+        boundaries.push_back(offset);
+    }
+    iter->isBoundary(position);
+}
+
+// Same as above, with the rule status of the boundary at the same index.
+void I18nBreakIterator::GetAllBoundaries(std::vector<int32_t> &boundaries, std::vector<int32_t> &ruleStatus)
+{
+    boundaries.clear();
+    ruleStatus.clear();
+    if (iter == nullptr) {
+        return;
+    }
+    int32_t position = iter->current();
+    boundaries.reserve(textLength / AVERAGE_BOUNDARY_DISTANCE + 1);
+    ruleStatus.reserve(textLength / AVERAGE_BOUNDARY_DISTANCE + 1);
+    for (int32_t offset = iter->first(); offset != icu::BreakIterator::DONE; offset = iter->next()) {
+        boundaries.push_back(offset);
+        ruleStatus.push_back(iter->getRuleStatus());
+    }
+    iter->isBoundary(position);
+}
 } // namespace I18n
 } // namespace Global
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "i18n_break_stream.h"
+#include "unicode/utf8.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+static constexpr int32_t MAX_TRAIL_BYTES = 3;
+
+// Returns the start of the character that ends at or after end if its bytes do not all lie before end, so that a
+// forced break never splits a character whose remaining bytes have not been appended yet.
+static int32_t GetCharStart(const std::string &text, int32_t end)
+{
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(text.data());
+    int32_t start = end;
+    while (start > 0 && end - start < MAX_TRAIL_BYTES && U8_IS_TRAIL(bytes[start - 1])) {
+        --start;
+    }
+    if (start == 0) {
+        return end;
+    }
+    --start;
+    if (!U8_IS_LEAD(bytes[start])) {
+        return end;
+    }
+    return (start + 1 + U8_COUNT_TRAIL_BYTES(bytes[start]) > end) ? start : end;
+}
+
+I18nBreakStream::I18nBreakStream(const std::string &localeTag, BreakIteratorType type)
+    : iterator(localeTag, type)
+{
+}
+
+void I18nBreakStream::Append(const char *text, size_t length)
+{
+    if (text == nullptr || length == 0 || finished) {
+        return;
+    }
+    Compact();
+    buffer.append(text, length);
+    textChanged = true;
+}
+
+void I18nBreakStream::Finish()
+{
+    finished = true;
+}
+
+// Returns false when no further boundary can be reported until more text is appended, or when the finished
+// stream has been consumed.
+bool I18nBreakStream::NextBoundary(int64_t &offset)
+{
+    int32_t length = static_cast<int32_t>(buffer.length());
+    if (cursor >= length) {
+        return false;
+    }
+    if (textChanged) {
+        // buffer may have been reallocated by Append, so the iterator is pointed at it again
+        if (!iterator.SetUTF8Text(buffer.data(), length)) {
+            return false;
+        }
+        textChanged = false;
+    }
+    int32_t next = iterator.following(cursor);
+    if (next <= cursor) {
+        return false;
+    }
+    if (!finished && length - next < MIN_LOOKAHEAD) {
+        if (length - cursor < MAX_BUFFERED) {
+            return false;
+        }
+        next = GetCharStart(buffer, next);
+        if (next <= cursor) {
+            return false;
+        }
+    }
+    cursor = next;
+    offset = bufferStart + next;
+    return true;
+}
+
+int64_t I18nBreakStream::GetPosition() const
+{
+    return bufferStart + cursor;
+}
+
+void I18nBreakStream::Reset(int64_t position)
+{
+    buffer.clear();
+    bufferStart = position;
+    cursor = 0;
+    textChanged = true;
+    finished = false;
+}
+
+// Drops the text before the last reported boundary. The boundary becomes the start of the buffer, where the
+// iterator starts afresh just as it would after a break.
+void I18nBreakStream::Compact()
+{
+    if (cursor == 0 || (cursor < COMPACT_THRESHOLD && cursor < static_cast<int32_t>(buffer.length()))) {
+        return;
+    }
+    buffer.erase(0, cursor);
+    bufferStart += cursor;
+    cursor = 0;
+}
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
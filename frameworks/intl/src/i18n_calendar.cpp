@@ -14,7 +14,15 @@
  */
 
 #include "i18n_calendar.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include "unicode/basictz.h"
 #include "unicode/gregocal.h"
+#include "unicode/tztrans.h"
 #include "buddhcal.h"
 #include "chnsecal.h"
 #include "coptccal.h"
@@ -34,6 +42,44 @@
 namespace OHOS {
 namespace Global {
 namespace I18n {
+static const int64_t ONE_DAY = 86400000; // milliseconds in one day
+static const int32_t MIDDAY = 12; // grid cells are sampled at noon so that DST shifts never change the date
+static const int32_t EPOCH_DAY_OF_WEEK = 4; // 1970-01-01 is a thursday, counted from sunday as 0
+static const int32_t BITS_PER_BYTE = 8;
+static const size_t MAX_PROTOTYPES = 64;
+static std::mutex g_prototypeMutex;
+static std::unordered_map<std::string, std::unique_ptr<icu::Calendar>> g_prototypes;
+static const int32_t TABLE_START_DAY = -25567; // 1900-01-01, in days since 1970-01-01
+static const int32_t TABLE_END_DAY = 47847; // 2101-01-01, in days since 1970-01-01
+static const int32_t EPOCH_JULIAN_DAY = 2440588; // julian day of 1970-01-01
+static const int32_t SHORT_MONTH_DAYS = 29; // months of the lunar calendars below have 29 or 30 days
+// calendars whose conversions are expensive and whose fields only depend on the local day
+static const char *g_monthTableTypes[] = { "chinese", "hebrew", "islamic-civil", "islamic-tbla", "islamic-umalqura" };
+static constexpr int32_t MONTH_TABLE_TYPES = sizeof(g_monthTableTypes) / sizeof(g_monthTableTypes[0]);
+
+struct MonthStartTable {
+    struct Month {
+        int32_t day; // first day of the month, in days since 1970-01-01
+        int32_t yearStart; // first day of the year, in days since 1970-01-01
+        int32_t era;
+        int32_t year;
+        int32_t extendedYear;
+        int32_t month;
+        int32_t isLeapMonth;
+    };
+    std::vector<Month> months;
+    int32_t endDay = 0;
+};
+
+// The table of a calendar type is built once, outside of any lock, and published through ready. Lookups only
+// read ready, so they never wait for a build in progress.
+struct MonthTableSlot {
+    std::once_flag built;
+    std::atomic<bool> ready { false };
+    std::shared_ptr<const MonthStartTable> table = nullptr;
+};
+static MonthTableSlot g_monthTables[MONTH_TABLE_TYPES];
+
 I18nCalendar::I18nCalendar(std::string localeTag)
 {
     UErrorCode status = U_ZERO_ERROR;
@@ -42,7 +88,12 @@ I18nCalendar::I18nCalendar(std::string localeTag)
         calendar_ = new icu::GregorianCalendar(status);
         return;
     }
+    std::string key = GetPrototypeKey(tempLocale, UNDEFINED);
+    if (ClonePrototype(key)) {
+        return;
+    }
     calendar_ = icu::Calendar::createInstance(tempLocale, status);
+    SavePrototype(key);
 }
 
 I18nCalendar::I18nCalendar(std::string localeTag, CalendarType type)
@@ -53,7 +104,60 @@ I18nCalendar::I18nCalendar(std::string localeTag, CalendarType type)
         calendar_ = new icu::GregorianCalendar(status);
         return;
     }
+    std::string key = GetPrototypeKey(tempLocale, type);
+    if (ClonePrototype(key)) {
+        return;
+    }
     InitCalendar(tempLocale, type);
+    SavePrototype(key);
+}
+
+bool I18nCalendar::Preload(const std::string &localeTag, CalendarType type)
+{
+    I18nCalendar calendar(localeTag, type);
+    calendar.LoadMonthTable(true);
+    return calendar.calendar_ != nullptr;
+}
+
+std::string I18nCalendar::GetPrototypeKey(const icu::Locale &locale, CalendarType type)
+{
+    return std::string(locale.getName()) + "|" + std::to_string(type);
+}
+
+bool I18nCalendar::ClonePrototype(const std::string &key)
+{
+    {
+        std::lock_guard<std::mutex> lock(g_prototypeMutex);
+        auto iter = g_prototypes.find(key);
+        if (iter == g_prototypes.end()) {
+            return false;
+        }
+        calendar_ = iter->second->clone();
+    }
+    if (calendar_ == nullptr) {
+        return false;
+    }
+    // a new calendar starts at the current time in the current default time zone, so a clone has to as well
+    UErrorCode status = U_ZERO_ERROR;
+    calendar_->adoptTimeZone(icu::TimeZone::createDefault());
+    calendar_->setTime(icu::Calendar::getNow(), status);
+    return true;
+}
+
+void I18nCalendar::SavePrototype(const std::string &key)
+{
+    if (calendar_ == nullptr) {
+        return;
+    }
+    std::unique_ptr<icu::Calendar> prototype(calendar_->clone());
+    if (prototype == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(g_prototypeMutex);
+    if (g_prototypes.size() >= MAX_PROTOTYPES) {
+        g_prototypes.clear();
+    }
+    g_prototypes.emplace(key, std::move(prototype));
 }
 
 void I18nCalendar::InitCalendar(const icu::Locale &locale, CalendarType type)
@@ -127,6 +231,7 @@ void I18nCalendar::InitCalendar2(const icu::Locale &locale, CalendarType type)
 I18nCalendar::~I18nCalendar()
 {
     delete calendar_;
+    delete fieldCalendar_;
 }
 
 void I18nCalendar::SetTime(double value)
@@ -147,6 +252,7 @@ void I18nCalendar::SetTimeZone(std::string id)
     }
     if (calendar_ != nullptr) {
         calendar_->setTimeZone(*timezone);
+        ResetFieldCalendar();
     }
     delete(timezone);
 }
@@ -191,6 +297,7 @@ void I18nCalendar::SetMinimalDaysInFirstWeek(int32_t value)
 {
     if (calendar_ != nullptr) {
         calendar_->setMinimalDaysInFirstWeek((uint8_t)value);
+        ResetFieldCalendar();
         return;
     }
 }
@@ -202,6 +309,7 @@ void I18nCalendar::SetFirstDayOfWeek(int32_t value)
     }
     if (calendar_ != nullptr) {
         calendar_->setFirstDayOfWeek(UCalendarDaysOfWeek(value));
+        ResetFieldCalendar();
         return;
     }
 }
@@ -224,10 +332,103 @@ int32_t I18nCalendar::GetFirstDayOfWeek(void)
 
 bool I18nCalendar::IsWeekend(int64_t date, UErrorCode &status)
 {
-    if (calendar_ != nullptr) {
+    if (calendar_ == nullptr) {
+        return false;
+    }
+    if (!LoadWeekendRules()) {
         return calendar_->isWeekend(date, status);
     }
-    return false;
+    int32_t rawOffset = 0;
+    int32_t dstOffset = 0;
+    calendar_->getTimeZone().getOffset(date, false, rawOffset, dstOffset, status);
+    if (U_FAILURE(status)) {
+        return false;
+    }
+    return IsLocalWeekend(date + rawOffset + dstOffset);
+}
+
+bool I18nCalendar::GetWeekendBitmap(int64_t date, int32_t days, std::vector<uint8_t> &bitmap)
+{
+    if (calendar_ == nullptr || days < 0 || !LoadWeekendRules()) {
+        return false;
+    }
+    bitmap.assign((days + BITS_PER_BYTE - 1) / BITS_PER_BYTE, 0);
+    const icu::TimeZone &zone = calendar_->getTimeZone();
+    const icu::BasicTimeZone *basicZone = dynamic_cast<const icu::BasicTimeZone *>(&zone);
+    int64_t offset = 0;
+    int64_t nextTransition = date;
+    for (int32_t i = 0; i < days; ++i) {
+        int64_t time = date + i * ONE_DAY;
+        // the offset only has to be looked up again once the next time zone transition has passed
+        if (time >= nextTransition) {
+            UErrorCode status = U_ZERO_ERROR;
+            int32_t rawOffset = 0;
+            int32_t dstOffset = 0;
+            zone.getOffset(time, false, rawOffset, dstOffset, status);
+            if (U_FAILURE(status)) {
+                bitmap.clear();
+                return false;
+            }
+            offset = rawOffset + dstOffset;
+            icu::TimeZoneTransition transition;
+            if (basicZone == nullptr) {
+                nextTransition = time;
+            } else if (basicZone->getNextTransition(time, false, transition)) {
+                nextTransition = static_cast<int64_t>(transition.getTime());
+            } else {
+                nextTransition = INT64_MAX;
+            }
+        }
+        if (IsLocalWeekend(time + offset)) {
+            bitmap[i / BITS_PER_BYTE] |= 1 << (i % BITS_PER_BYTE);
+        }
+    }
+    return true;
+}
+
+bool I18nCalendar::LoadWeekendRules()
+{
+    if (weekendLoaded_) {
+        return true;
+    }
+    if (calendar_ == nullptr) {
+        return false;
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    for (int32_t i = 0; i < DAYS_PER_WEEK; ++i) {
+        UCalendarDaysOfWeek day = static_cast<UCalendarDaysOfWeek>(UCAL_SUNDAY + i);
+        dayTypes_[i] = calendar_->getDayOfWeekType(day, status);
+        weekendTransitions_[i] = 0;
+        if (dayTypes_[i] == UCAL_WEEKEND_ONSET || dayTypes_[i] == UCAL_WEEKEND_CEASE) {
+            weekendTransitions_[i] = calendar_->getWeekendTransition(day, status);
+        }
+    }
+    weekendLoaded_ = U_SUCCESS(status);
+    return weekendLoaded_;
+}
+
+bool I18nCalendar::IsLocalWeekend(int64_t localMillis) const
+{
+    int64_t day = localMillis / ONE_DAY;
+    int64_t millisInDay = localMillis % ONE_DAY;
+    if (millisInDay < 0) {
+        --day;
+        millisInDay += ONE_DAY;
+    }
+    int32_t index = static_cast<int32_t>((day + EPOCH_DAY_OF_WEEK) % DAYS_PER_WEEK);
+    if (index < 0) {
+        index += DAYS_PER_WEEK;
+    }
+    switch (dayTypes_[index]) {
+        case UCAL_WEEKEND:
+            return true;
+        case UCAL_WEEKEND_ONSET:
+            return millisInDay >= weekendTransitions_[index];
+        case UCAL_WEEKEND_CEASE:
+            return millisInDay < weekendTransitions_[index];
+        default:
+            return false;
+    }
 }
 
 bool I18nCalendar::IsWeekend(void)
@@ -269,6 +470,215 @@ std::string I18nCalendar::GetDisplayName(std::string &displayLocale)
     unistr.toUTF8String<std::string>(ret);
     return ret;
 }
+
+icu::Calendar *I18nCalendar::GetFieldCalendar()
+{
+    if (fieldCalendar_ == nullptr && calendar_ != nullptr) {
+        fieldCalendar_ = calendar_->clone();
+    }
+    return fieldCalendar_;
+}
+
+void I18nCalendar::ResetFieldCalendar()
+{
+    delete fieldCalendar_;
+    fieldCalendar_ = nullptr;
+}
+
+bool I18nCalendar::GetFields(double time, const UCalendarDateFields *fields, int32_t *out, size_t count)
+{
+    icu::Calendar *calendar = GetFieldCalendar();
+    if (calendar == nullptr || (count > 0 && (fields == nullptr || out == nullptr))) {
+        return false;
+    }
+    if (GetTableFields(time, fields, out, count)) {
+        return true;
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    calendar->setTime(time, status);
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = calendar->get(fields[i], status);
+    }
+    return U_SUCCESS(status);
+}
+
+bool I18nCalendar::GetMonthGrid(int32_t year, int32_t month, const UCalendarDateFields *fields, size_t count,
+    std::vector<int32_t> &cells)
+{
+    icu::Calendar *calendar = GetFieldCalendar();
+    if (calendar == nullptr || calendar_ == nullptr || (count > 0 && fields == nullptr)) {
+        return false;
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    // start from the current time of calendar_ so that fields not given here, such as the era, are kept
+    calendar->setTime(calendar_->getTime(status), status);
+    calendar->set(year, month, 1, MIDDAY, 0, 0);
+    calendar->set(UCAL_MILLISECOND, 0);
+    int32_t lead = calendar->get(UCAL_DAY_OF_WEEK, status) - calendar->getFirstDayOfWeek();
+    if (lead < 0) {
+        lead += DAYS_PER_WEEK;
+    }
+    double start = calendar->getTime(status) - lead * ONE_DAY;
+    if (U_FAILURE(status)) {
+        return false;
+    }
+    cells.resize(MONTH_GRID_CELLS * count);
+    for (int32_t i = 0; i < MONTH_GRID_CELLS; ++i) {
+        if (!GetFields(start + i * ONE_DAY, fields, cells.data() + i * count, count)) {
+            cells.clear();
+            return false;
+        }
+    }
+    return true;
+}
+
+bool I18nCalendar::LoadMonthTable(bool build)
+{
+    if (monthTable_ != nullptr) {
+        return true;
+    }
+    if (!monthTableChecked_) {
+        monthTableChecked_ = true;
+        const char *type = (calendar_ == nullptr) ? nullptr : calendar_->getType();
+        for (int32_t i = 0; type != nullptr && i < MONTH_TABLE_TYPES; ++i) {
+            if (strcmp(type, g_monthTableTypes[i]) == 0) {
+                monthTableSlot_ = i;
+                break;
+            }
+        }
+    }
+    if (monthTableSlot_ < 0) {
+        return false;
+    }
+    MonthTableSlot &slot = g_monthTables[monthTableSlot_];
+    if (build) {
+        std::call_once(slot.built, [&slot, this] {
+            slot.table = BuildMonthTable(*calendar_);
+            slot.ready.store(true, std::memory_order_release);
+        });
+    }
+    if (!slot.ready.load(std::memory_order_acquire)) {
+        return false;
+    }
+    monthTable_ = slot.table;
+    return monthTable_ != nullptr;
+}
+
+std::shared_ptr<const MonthStartTable> I18nCalendar::BuildMonthTable(const icu::Calendar &prototype)
+{
+    std::unique_ptr<icu::Calendar> calendar(prototype.clone());
+    if (calendar == nullptr) {
+        return nullptr;
+    }
+    // in GMT the local day of a time is simply its day since 1970-01-01
+    calendar->setTimeZone(*icu::TimeZone::getGMT());
+    UErrorCode status = U_ZERO_ERROR;
+    calendar->setTime(static_cast<double>(TABLE_START_DAY) * ONE_DAY, status);
+    int32_t start = TABLE_START_DAY - calendar->get(UCAL_DATE, status) + 1;
+    calendar->setTime(static_cast<double>(start) * ONE_DAY, status);
+    std::shared_ptr<MonthStartTable> table = std::make_shared<MonthStartTable>();
+    while (start < TABLE_END_DAY && U_SUCCESS(status)) {
+        MonthStartTable::Month month;
+        month.day = start;
+        month.yearStart = start - calendar->get(UCAL_DAY_OF_YEAR, status) + 1;
+        month.era = calendar->get(UCAL_ERA, status);
+        month.year = calendar->get(UCAL_YEAR, status);
+        month.extendedYear = calendar->get(UCAL_EXTENDED_YEAR, status);
+        month.month = calendar->get(UCAL_MONTH, status);
+        month.isLeapMonth = calendar->get(UCAL_IS_LEAP_MONTH, status);
+        table->months.push_back(month);
+        // the day after a short month is already the start of the next month, so it is read only once
+        start += SHORT_MONTH_DAYS;
+        calendar->setTime(static_cast<double>(start) * ONE_DAY, status);
+        int32_t date = calendar->get(UCAL_DATE, status);
+        if (date == SHORT_MONTH_DAYS + 1) {
+            ++start;
+            calendar->setTime(static_cast<double>(start) * ONE_DAY, status);
+        } else if (date != 1) {
+            return nullptr;
+        }
+    }
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    table->endDay = start;
+    return table;
+}
+
+bool I18nCalendar::GetTableFields(double time, const UCalendarDateFields *fields, int32_t *out, size_t count)
+{
+    if (!LoadMonthTable(false)) {
+        return false;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        switch (fields[i]) {
+            case UCAL_ERA:
+            case UCAL_YEAR:
+            case UCAL_EXTENDED_YEAR:
+            case UCAL_MONTH:
+            case UCAL_IS_LEAP_MONTH:
+            case UCAL_DATE:
+            case UCAL_DAY_OF_YEAR:
+            case UCAL_DAY_OF_WEEK:
+            case UCAL_JULIAN_DAY:
+                break;
+            default:
+                return false;
+        }
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t rawOffset = 0;
+    int32_t dstOffset = 0;
+    calendar_->getTimeZone().getOffset(time, false, rawOffset, dstOffset, status);
+    if (U_FAILURE(status) || !std::isfinite(time)) {
+        return false;
+    }
+    double day = std::floor((time + rawOffset + dstOffset) / ONE_DAY);
+    const std::vector<MonthStartTable::Month> &months = monthTable_->months;
+    if (months.empty() || day < months.front().day || day >= monthTable_->endDay) {
+        return false;
+    }
+    int32_t localDay = static_cast<int32_t>(day);
+    auto iter = std::upper_bound(months.begin(), months.end(), localDay,
+        [](int32_t value, const MonthStartTable::Month &month) { return value < month.day; });
+    const MonthStartTable::Month &month = *(iter - 1);
+    for (size_t i = 0; i < count; ++i) {
+        switch (fields[i]) {
+            case UCAL_ERA:
+                out[i] = month.era;
+                break;
+            case UCAL_YEAR:
+                out[i] = month.year;
+                break;
+            case UCAL_EXTENDED_YEAR:
+                out[i] = month.extendedYear;
+                break;
+            case UCAL_MONTH:
+                out[i] = month.month;
+                break;
+            case UCAL_IS_LEAP_MONTH:
+                out[i] = month.isLeapMonth;
+                break;
+            case UCAL_DATE:
+                out[i] = localDay - month.day + 1;
+                break;
+            case UCAL_DAY_OF_YEAR:
+                out[i] = localDay - month.yearStart + 1;
+                break;
+            case UCAL_DAY_OF_WEEK: {
+                int32_t index = (localDay + EPOCH_DAY_OF_WEEK) % DAYS_PER_WEEK;
+                out[i] = ((index < 0) ? index + DAYS_PER_WEEK : index) + UCAL_SUNDAY;
+                break;
+            }
+            case UCAL_JULIAN_DAY:
+                out[i] = localDay + EPOCH_JULIAN_DAY;
+                break;
+            default:
+                break;
+        }
+    }
+    return true;
+}
 } // namespace I18n
 } // namespace Global
 } // namespace OHOS
\ No newline at end of file
@@ -13,35 +13,76 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
 #include "locale_config.h"
+#include "unicode/basictz.h"
+#include "unicode/coll.h"
 #include "unicode/locid.h"
+#include "unicode/strenum.h"
+#include "unicode/tznames.h"
+#include "unicode/tztrans.h"
 #include "unicode/unistr.h"
 #include "i18n_timezone.h"
 
 namespace OHOS {
 namespace Global {
 namespace I18n {
+// zone ID -> zone shared by every I18nTimeZone created with that ID
+static std::unordered_map<std::string, std::shared_ptr<const icu::TimeZone>> g_timeZones;
+static std::mutex g_timeZonesMutex;
+static constexpr size_t MAX_TIMEZONES = 1024;
+// zone ID, locale, DST and style -> display name
+static std::unordered_map<std::string, std::string> g_displayNames;
+static std::mutex g_displayNamesMutex;
+static constexpr size_t MAX_DISPLAY_NAMES = 4096;
+// locale -> picker rows sorted by display name, without offsets
+static std::unordered_map<std::string, std::vector<TimeZoneItem>> g_timeZoneItems;
+static std::mutex g_timeZoneItemsMutex;
+static constexpr size_t MAX_TIME_ZONE_ITEM_LOCALES = 4;
+
 I18nTimeZone::I18nTimeZone(std::string zoneID)
 {
     if (zoneID.empty()) {
-        timezone = icu::TimeZone::createDefault();
+        // the default zone follows the system setting, so it is not shared
+        timezone.reset(icu::TimeZone::createDefault());
     } else {
-        icu::UnicodeString unicodeZoneID(zoneID.data(), zoneID.length());
-        timezone = icu::TimeZone::createTimeZone(unicodeZoneID);
+        timezone = GetSharedTimeZone(zoneID);
+    }
+    if (timezone != nullptr) {
+        icu::UnicodeString unicodeZoneID;
+        timezone->getID(unicodeZoneID);
+        unicodeZoneID.toUTF8String(id);
     }
 }
 
 I18nTimeZone::~I18nTimeZone()
 {
-    if (timezone != nullptr) {
-        delete timezone;
-        timezone = nullptr;
-    }
 }
 
-icu::TimeZone* I18nTimeZone::GetTimeZone()
+const icu::TimeZone* I18nTimeZone::GetTimeZone()
 {
-    return timezone;
+    return timezone.get();
+}
+
+std::shared_ptr<const icu::TimeZone> I18nTimeZone::GetSharedTimeZone(const std::string &zoneID)
+{
+    std::lock_guard<std::mutex> lock(g_timeZonesMutex);
+    auto iter = g_timeZones.find(zoneID);
+    if (iter != g_timeZones.end()) {
+        return iter->second;
+    }
+    icu::UnicodeString unicodeZoneID(zoneID.data(), zoneID.length());
+    std::shared_ptr<const icu::TimeZone> zone(icu::TimeZone::createTimeZone(unicodeZoneID));
+    if (zone == nullptr) {
+        return nullptr;
+    }
+    if (g_timeZones.size() >= MAX_TIMEZONES) {
+        g_timeZones.clear();
+    }
+    g_timeZones.emplace(zoneID, zone);
+    return zone;
 }
 
 std::unique_ptr<I18nTimeZone> I18nTimeZone::CreateInstance(std::string zoneID)
@@ -54,6 +95,54 @@ std::unique_ptr<I18nTimeZone> I18nTimeZone::CreateInstance(std::string zoneID)
 }
 
 int32_t I18nTimeZone::GetOffset(double date)
+{
+    if (!transitionsLoaded && ++offsetCalls >= TRANSITIONS_THRESHOLD) {
+        LoadTransitions();
+    }
+    if (transitionsLoaded && date >= windowStart && date < windowEnd) {
+        return transitionOffsets[FindSegment(date)];
+    }
+    return GetIcuOffset(date);
+}
+
+// Sorted dates are looked up fastest, as consecutive dates usually fall between the same two transitions.
+void I18nTimeZone::GetOffsets(const double *dates, int32_t *offsets, size_t count)
+{
+    if (dates == nullptr || offsets == nullptr) {
+        return;
+    }
+    LoadTransitions();
+    size_t segment = 0;
+    double segmentStart = 0;
+    double segmentEnd = 0;
+    for (size_t i = 0; i < count; ++i) {
+        double date = dates[i];
+        if (!transitionsLoaded || !(date >= windowStart && date < windowEnd)) {
+            offsets[i] = GetIcuOffset(date);
+            continue;
+        }
+        if (!(date >= segmentStart && date < segmentEnd)) {
+            segment = FindSegment(date);
+            segmentStart = (segment == 0) ? windowStart : transitions[segment - 1];
+            segmentEnd = (segment == transitions.size()) ? windowEnd : transitions[segment];
+        }
+        offsets[i] = transitionOffsets[segment];
+    }
+}
+
+// Builds the transition table for the years [startYear, endYear). Returns false if the window is invalid.
+bool I18nTimeZone::SetTransitionWindow(int32_t startYear, int32_t endYear)
+{
+    if (startYear >= endYear) {
+        return false;
+    }
+    this->startYear = startYear;
+    this->endYear = endYear;
+    transitionsLoaded = false;
+    return LoadTransitions();
+}
+
+int32_t I18nTimeZone::GetIcuOffset(double date)
 {
     int32_t rawOffset = 0;
     int32_t dstOffset = 0;
@@ -66,6 +155,48 @@ int32_t I18nTimeZone::GetOffset(double date)
     return rawOffset + dstOffset;
 }
 
+// Returns the UTC time in milliseconds of January 1st of year in the proleptic Gregorian calendar.
+static double GetYearStart(int32_t year)
+{
+    int64_t y = static_cast<int64_t>(year) - 1;
+    // 365, 4, 100 and 400 give the days of the years before year, 719162 the days from 0001-01-01 to 1970-01-01
+    int64_t days = y * 365 + y / 4 - y / 100 + y / 400 - 719162;
+    return static_cast<double>(days) * U_MILLIS_PER_DAY;
+}
+
+bool I18nTimeZone::LoadTransitions()
+{
+    if (transitionsLoaded) {
+        return true;
+    }
+    const icu::BasicTimeZone *basicZone = dynamic_cast<const icu::BasicTimeZone *>(timezone.get());
+    if (basicZone == nullptr) {
+        return false;
+    }
+    windowStart = GetYearStart(startYear);
+    windowEnd = GetYearStart(endYear);
+    transitions.clear();
+    transitionOffsets.clear();
+    transitionOffsets.push_back(GetIcuOffset(windowStart));
+    icu::TimeZoneTransition transition;
+    double base = windowStart;
+    while (basicZone->getNextTransition(base, false, transition) && transition.getTime() < windowEnd) {
+        base = transition.getTime();
+        int32_t offset = transition.getTo()->getRawOffset() + transition.getTo()->getDSTSavings();
+        if (offset != transitionOffsets.back()) {
+            transitions.push_back(base);
+            transitionOffsets.push_back(offset);
+        }
+    }
+    transitionsLoaded = true;
+    return true;
+}
+
+size_t I18nTimeZone::FindSegment(double date) const
+{
+    return std::upper_bound(transitions.begin(), transitions.end(), date) - transitions.begin();
+}
+
 int32_t I18nTimeZone::GetRawOffset()
 {
     return timezone->getRawOffset();
@@ -73,11 +204,7 @@ int32_t I18nTimeZone::GetRawOffset()
 
 std::string I18nTimeZone::GetID()
 {
-    icu::UnicodeString zoneID;
-    timezone->getID(zoneID);
-    std::string result;
-    zoneID.toUTF8String(result);
-    return result;
+    return id;
 }
 
 std::string I18nTimeZone::GetDisplayName()
@@ -99,14 +226,137 @@ std::string I18nTimeZone::GetDisplayName(std::string localeStr)
 
 std::string I18nTimeZone::GetDisplayName(std::string localeStr, bool isDST)
 {
-    icu::TimeZone::EDisplayType style = icu::TimeZone::EDisplayType::LONG_GENERIC;
     icu::Locale locale(localeStr.data());
+    return GetCachedDisplayName(*timezone, id, locale, isDST);
+}
+
+std::string I18nTimeZone::GetCachedDisplayName(const icu::TimeZone &zone, const std::string &zoneID,
+    const icu::Locale &locale, bool isDST)
+{
+    icu::TimeZone::EDisplayType style = icu::TimeZone::EDisplayType::LONG_GENERIC;
+    std::string key = zoneID;
+    key.append("|").append(locale.getName()).append(isDST ? "|1|" : "|0|").append(std::to_string(style));
+    {
+        std::lock_guard<std::mutex> lock(g_displayNamesMutex);
+        auto iter = g_displayNames.find(key);
+        if (iter != g_displayNames.end()) {
+            return iter->second;
+        }
+    }
     icu::UnicodeString name;
-    timezone->getDisplayName((UBool)isDST, style, locale, name);
+    zone.getDisplayName((UBool)isDST, style, locale, name);
     std::string result;
     name.toUTF8String(result);
+    std::lock_guard<std::mutex> lock(g_displayNamesMutex);
+    if (g_displayNames.size() >= MAX_DISPLAY_NAMES) {
+        g_displayNames.clear();
+    }
+    g_displayNames.emplace(key, result);
     return result;
 }
+
+// Fills names with (zone ID, display name) pairs for every canonical location zone, in ID order.
+bool I18nTimeZone::GetDisplayNames(const std::string &localeStr, bool isDST,
+    std::vector<std::pair<std::string, std::string>> &names)
+{
+    names.clear();
+    UErrorCode status = U_ZERO_ERROR;
+    std::unique_ptr<icu::StringEnumeration> zoneIDs(icu::TimeZone::createTimeZoneIDEnumeration(
+        UCAL_ZONE_TYPE_CANONICAL_LOCATION, nullptr, nullptr, status));
+    if (U_FAILURE(status) || zoneIDs == nullptr) {
+        return false;
+    }
+    icu::Locale locale(localeStr.data());
+    const char *zoneID = nullptr;
+    int32_t length = 0;
+    while ((zoneID = zoneIDs->next(&length, status)) != nullptr && U_SUCCESS(status)) {
+        std::string zoneStr(zoneID, length);
+        std::shared_ptr<const icu::TimeZone> zone = GetSharedTimeZone(zoneStr);
+        if (zone == nullptr) {
+            continue;
+        }
+        names.emplace_back(zoneStr, GetCachedDisplayName(*zone, zoneStr, locale, isDST));
+    }
+    return U_SUCCESS(status);
+}
+// Fills items with a row for every canonical location zone, ordered by offset at date and then by display name.
+// Everything but the offsets is computed once per locale.
+bool I18nTimeZone::GetTimeZoneItems(const std::string &localeStr, double date, std::vector<TimeZoneItem> &items)
+{
+    items.clear();
+    {
+        std::lock_guard<std::mutex> lock(g_timeZoneItemsMutex);
+        auto iter = g_timeZoneItems.find(localeStr);
+        if (iter != g_timeZoneItems.end()) {
+            items = iter->second;
+        }
+    }
+    if (items.empty()) {
+        if (!LoadTimeZoneItems(localeStr, items)) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(g_timeZoneItemsMutex);
+        if (g_timeZoneItems.size() >= MAX_TIME_ZONE_ITEM_LOCALES) {
+            g_timeZoneItems.clear();
+        }
+        g_timeZoneItems.emplace(localeStr, items);
+    }
+    for (TimeZoneItem &item : items) {
+        std::shared_ptr<const icu::TimeZone> zone = GetSharedTimeZone(item.zoneID);
+        int32_t rawOffset = 0;
+        int32_t dstOffset = 0;
+        UErrorCode status = U_ZERO_ERROR;
+        if (zone != nullptr) {
+            zone->getOffset(date, false, rawOffset, dstOffset, status);
+        }
+        item.offset = U_SUCCESS(status) ? rawOffset + dstOffset : 0;
+    }
+    std::stable_sort(items.begin(), items.end(),
+        [](const TimeZoneItem &left, const TimeZoneItem &right) { return left.offset < right.offset; });
+    return true;
+}
+
+bool I18nTimeZone::LoadTimeZoneItems(const std::string &localeStr, std::vector<TimeZoneItem> &items)
+{
+    std::vector<std::pair<std::string, std::string>> names;
+    if (!GetDisplayNames(localeStr, false, names)) {
+        return false;
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    icu::Locale locale(localeStr.data());
+    std::unique_ptr<icu::TimeZoneNames> zoneNames(icu::TimeZoneNames::createInstance(locale, status));
+    if (U_FAILURE(status)) {
+        return false;
+    }
+    std::unique_ptr<icu::Collator> collator(icu::Collator::createInstance(locale, status));
+    if (U_FAILURE(status)) {
+        return false;
+    }
+    items.clear();
+    items.reserve(names.size());
+    for (const auto &name : names) {
+        TimeZoneItem item;
+        item.zoneID = name.first;
+        item.offset = 0;
+        item.displayName = name.second;
+        icu::UnicodeString unicodeZoneID = icu::UnicodeString::fromUTF8(name.first);
+        char region[4] = { 0 }; // 4 is enough for region codes such as "001"
+        icu::TimeZone::getRegion(unicodeZoneID, region, sizeof(region), status);
+        if (U_SUCCESS(status)) {
+            item.country = region;
+        }
+        status = U_ZERO_ERROR;
+        icu::UnicodeString city;
+        zoneNames->getExemplarLocationName(unicodeZoneID, city);
+        city.toUTF8String(item.city);
+        items.push_back(std::move(item));
+    }
+    std::stable_sort(items.begin(), items.end(), [&collator](const TimeZoneItem &left, const TimeZoneItem &right) {
+        UErrorCode status = U_ZERO_ERROR;
+        return collator->compareUTF8(left.displayName, right.displayName, status) == UCOL_LESS;
+    });
+    return true;
+}
+}
 }
 }
-}
\ No newline at end of file
@@ -13,7 +13,10 @@
  * limitations under the License.
  */
 #include "index_util.h"
+#include <algorithm>
+#include <thread>
 #include "locale_config.h"
+#include "unicode/tblcoll.h"
 
 namespace OHOS {
 namespace Global {
@@ -36,18 +39,10 @@ IndexUtil::~IndexUtil()
 
 std::vector<std::string> IndexUtil::GetIndexList()
 {
-    UErrorCode status = U_ZERO_ERROR;
-    std::vector<std::string> indexList;
-    index->resetBucketIterator(status);
-    while (index->nextBucket(status)) {
-        if (status == U_ZERO_ERROR) {
-            icu::UnicodeString unicodeString = index->getBucketLabel();
-            std::string label;
-            unicodeString.toUTF8String(label);
-            indexList.push_back(label);
-        }
+    if (!LoadLabels()) {
+        return {};
     }
-    return indexList;
+    return labels;
 }
 
 void IndexUtil::AddLocale(const std::string &localeTag)
@@ -55,27 +50,121 @@ void IndexUtil::AddLocale(const std::string &localeTag)
     UErrorCode status = U_ZERO_ERROR;
     icu::Locale locale(localeTag.c_str());
     index->addLabels(locale, status);
+    labelsLoaded = false;
+    immutableIndex = nullptr;
 }
 
-std::string IndexUtil::GetIndex(const std::string &String)
+// The returned label stays valid until the next call to AddLocale.
+const std::string &IndexUtil::GetIndex(const std::string &String)
 {
+    if (!LoadLabels()) {
+        return emptyLabel;
+    }
     UErrorCode status = U_ZERO_ERROR;
-    icu::UnicodeString unicodeString(String.c_str());
+    icu::UnicodeString unicodeString = icu::UnicodeString::fromUTF8(String);
     int32_t bucketNumber = index->getBucketIndex(unicodeString, status);
-    if (status != U_ZERO_ERROR) {
-        return "";
+    if (status != U_ZERO_ERROR || bucketNumber < 0 || static_cast<size_t>(bucketNumber) >= labels.size()) {
+        return emptyLabel;
+    }
+    return labels[bucketNumber];
+}
+
+bool IndexUtil::LoadLabels()
+{
+    if (labelsLoaded) {
+        return true;
     }
+    UErrorCode status = U_ZERO_ERROR;
+    labels.clear();
     index->resetBucketIterator(status);
-    for (int32_t i = 0; i <= bucketNumber; i++) {
-        index->nextBucket(status);
-        if (status != U_ZERO_ERROR) {
-            return "";
+    while (index->nextBucket(status)) {
+        std::string label;
+        index->getBucketLabel().toUTF8String(label);
+        labels.push_back(label);
+    }
+    // nextBucket reports a failure by returning false, so it only shows up in status after the loop
+    if (U_FAILURE(status)) {
+        labels.clear();
+        return false;
+    }
+    labelsLoaded = true;
+    return true;
+}
+
+bool IndexUtil::LoadImmutableIndex()
+{
+    if (immutableIndex != nullptr) {
+        return true;
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    immutableIndex.reset(index->buildImmutableIndex(status));
+    if (U_FAILURE(status)) {
+        immutableIndex = nullptr;
+        return false;
+    }
+    return immutableIndex != nullptr;
+}
+
+// buckets[i] is the bucket index of names[i], the same index GetIndexList uses, or -1 if it can not be found.
+// Long lists are split between several threads.
+bool IndexUtil::AssignBuckets(const std::vector<std::string> &names, std::vector<int32_t> &buckets)
+{
+    buckets.assign(names.size(), -1);
+    if (!LoadImmutableIndex()) {
+        return false;
+    }
+    unsigned int threadCount = std::min(std::thread::hardware_concurrency(), MAX_THREADS);
+    if (names.size() < PARALLEL_THRESHOLD || threadCount < 2) { // 2 threads at least to be worth splitting
+        AssignRange(names, buckets, 0, names.size());
+        return true;
+    }
+    size_t step = (names.size() + threadCount - 1) / threadCount;
+    std::vector<std::thread> workers;
+    for (size_t begin = step; begin < names.size(); begin += step) {
+        workers.emplace_back(&IndexUtil::AssignRange, this, std::cref(names), std::ref(buckets), begin,
+            std::min(begin + step, names.size()));
+    }
+    AssignRange(names, buckets, 0, step);
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+    return true;
+}
+
+void IndexUtil::AssignRange(const std::vector<std::string> &names, std::vector<int32_t> &buckets, size_t begin,
+    size_t end) const
+{
+    for (size_t i = begin; i < end; ++i) {
+        UErrorCode status = U_ZERO_ERROR;
+        int32_t bucket = immutableIndex->getBucketIndex(icu::UnicodeString::fromUTF8(names[i]), status);
+        if (U_SUCCESS(status)) {
+            buckets[i] = bucket;
         }
     }
-    icu::UnicodeString label = index->getBucketLabel();
-    std::string result;
-    label.toUTF8String(result);
-    return result;
+}
+
+// groups[bucket] lists the positions in names of the records in that bucket, in collation order.
+bool IndexUtil::GroupByBucket(const std::vector<std::string> &names, std::vector<std::vector<int32_t>> &groups)
+{
+    groups.clear();
+    std::vector<int32_t> buckets;
+    if (!AssignBuckets(names, buckets)) {
+        return false;
+    }
+    groups.resize(immutableIndex->getBucketCount());
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        if (buckets[i] >= 0 && static_cast<size_t>(buckets[i]) < groups.size()) {
+            groups[buckets[i]].push_back(static_cast<int32_t>(i));
+        }
+    }
+    const icu::RuleBasedCollator &collator = index->getCollator();
+    for (std::vector<int32_t> &group : groups) {
+        std::stable_sort(group.begin(), group.end(), [&names, &collator](int32_t left, int32_t right) {
+            UErrorCode status = U_ZERO_ERROR;
+            return collator.compareUTF8(names[left], names[right], status) == UCOL_LESS;
+        });
+    }
+    return true;
 }
 } // namespace I18n
 } // namespace Global
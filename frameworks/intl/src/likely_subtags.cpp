@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "likely_subtags.h"
+#include <mutex>
+#include "unicode/locid.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+std::shared_mutex LikelySubtags::cacheMutex;
+std::unordered_map<std::string, std::string> LikelySubtags::maximizeCache;
+std::unordered_map<std::string, std::string> LikelySubtags::minimizeCache;
+std::atomic<uint64_t> LikelySubtags::hitCount(0);
+std::atomic<uint64_t> LikelySubtags::missCount(0);
+
+bool LikelySubtags::Maximize(const std::string &baseName, std::string &result)
+{
+    return Lookup(baseName, true, result);
+}
+
+bool LikelySubtags::Minimize(const std::string &baseName, std::string &result)
+{
+    return Lookup(baseName, false, result);
+}
+
+void LikelySubtags::GetStatistics(uint64_t &hits, uint64_t &misses)
+{
+    hits = hitCount.load(std::memory_order_relaxed);
+    misses = missCount.load(std::memory_order_relaxed);
+}
+
+void LikelySubtags::Clear()
+{
+    std::unique_lock<std::shared_mutex> lock(cacheMutex);
+    maximizeCache.clear();
+    minimizeCache.clear();
+    hitCount.store(0, std::memory_order_relaxed);
+    missCount.store(0, std::memory_order_relaxed);
+}
+
+bool LikelySubtags::Lookup(const std::string &baseName, bool maximize, std::string &result)
+{
+    std::unordered_map<std::string, std::string> &cache = maximize ? maximizeCache : minimizeCache;
+    {
+        std::shared_lock<std::shared_mutex> lock(cacheMutex);
+        auto iter = cache.find(baseName);
+        if (iter != cache.end()) {
+            hitCount.fetch_add(1, std::memory_order_relaxed);
+            result = iter->second;
+            return true;
+        }
+    }
+    missCount.fetch_add(1, std::memory_order_relaxed);
+    UErrorCode status = U_ZERO_ERROR;
+    icu::Locale locale(baseName.c_str());
+    if (maximize) {
+        locale.addLikelySubtags(status);
+    } else {
+        locale.minimizeSubtags(status);
+    }
+    if (status != U_ZERO_ERROR || locale.isBogus()) {
+        return false;
+    }
+    result = (locale.getBaseName() == nullptr) ? "" : locale.getBaseName();
+    std::unique_lock<std::shared_mutex> lock(cacheMutex);
+    if (cache.size() >= MAX_CACHE_SIZE) {
+        cache.clear();
+    }
+    cache.emplace(baseName, result);
+    return true;
+}
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
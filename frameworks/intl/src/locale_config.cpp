@@ -12,6 +12,8 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
+#include <memory>
 #include <regex>
 #include "accesstoken_kit.h"
 #ifdef TEL_CORE_SERVICE_EXISTS
@@ -20,6 +22,7 @@
 #include "hilog/log.h"
 #include "ipc_skeleton.h"
 #include "libxml/parser.h"
+#include "likely_subtags.h"
 #include "locale_info.h"
 #include "localebuilder.h"
 #include "locid.h"
@@ -27,6 +30,7 @@
 #include "parameter.h"
 #include "securec.h"
 #include "string_ex.h"
+#include "unicode/coll.h"
 #include "ucase.h"
 #include "ulocimp.h"
 #include "unistr.h"
@@ -61,6 +65,10 @@ const char *LocaleConfig::WHITE_LANGUAGES_PATH = "/system/usr/ohos_locale_config
 unordered_set<string> LocaleConfig::supportedLocales;
 unordered_set<string> LocaleConfig::supportedRegions;
 unordered_set<string> LocaleConfig::whiteLanguages;
+unordered_map<string, unordered_set<string>> LocaleConfig::suggestedLanguages;
+once_flag LocaleConfig::suggestedLanguagesFlag;
+unordered_map<string, string> LocaleConfig::mainLanguages;
+mutex LocaleConfig::mainLanguagesMutex;
 unordered_map<string, string> LocaleConfig::dialectMap {
     { "es-Latn-419", "es-Latn-419" },
     { "es-Latn-BO", "es-Latn-419" },
@@ -173,6 +181,18 @@ static unordered_map<string, string> g_languageMap = {
     { "mai-Deva", "mai-Deva" }
 };
 
+struct DisplayNames {
+    // 0 holds names as returned by icu, 1 holds sentence case names
+    unordered_map<string, string> names[2];
+};
+
+// display locale tag -> display names of languages or regions
+static unordered_map<string, DisplayNames> g_displayLanguages;
+static unordered_map<string, DisplayNames> g_displayRegions;
+static mutex g_displayNamesMutex;
+static constexpr size_t MAX_DISPLAY_LOCALES = 8;
+static constexpr size_t MAX_DISPLAY_NAMES = 1024;
+
 string Adjust(const string &origin)
 {
     for (auto iter = g_languageMap.begin(); iter != g_languageMap.end(); ++iter) {
@@ -256,32 +276,33 @@ void GetDisplayLanguageImpl(const char *locale, const char *displayLocale, icu::
     result.releaseBuffer(U_SUCCESS(status) ? length : 0);
 }
 
-string GetDisplayLanguageInner(const string &language, const string &displayLocale, bool sentenceCase)
+// displayLoc is nullptr when the display locale tag can not be parsed.
+string ComputeDisplayLanguage(const string &language, const icu::Locale *displayLoc, bool sentenceCase)
 {
-    icu::UnicodeString unistr;
+    string adjust = Adjust(language);
     // 0 is the start position of language, 2 is the length of zh and fa
-    if (!language.compare(0, 2, "zh") || !language.compare(0, 2, "fa")) {
-        UErrorCode error = U_ZERO_ERROR;
-        icu::Locale disLocale = icu::Locale::forLanguageTag(displayLocale, error);
-        if (error != U_ZERO_ERROR) {
-            return language;
-        }
-        const char *name = disLocale.getName();
+    bool dialect = (adjust != language) && (!adjust.compare(0, 2, "zh") || !adjust.compare(0, 2, "fa"));
+    if (!displayLoc) {
+        return dialect ? adjust : "";
+    }
+    icu::UnicodeString unistr;
+    if (dialect) {
+        const char *name = displayLoc->getName();
         if (!name) {
-            return language;
+            return adjust;
         }
-        GetDisplayLanguageImpl(language.c_str(), name, unistr);
+        GetDisplayLanguageImpl(adjust.c_str(), name, unistr);
     } else {
         UErrorCode status = U_ZERO_ERROR;
-        icu::Locale displayLoc = icu::Locale::forLanguageTag(displayLocale, status);
+        icu::Locale locale = icu::Locale::forLanguageTag(adjust, status);
         if (status != U_ZERO_ERROR) {
             return "";
         }
-        icu::Locale locale = icu::Locale::forLanguageTag(language, status);
-        if (status != U_ZERO_ERROR) {
-            return "";
+        if (adjust == language) {
+            locale.getDisplayLanguage(*displayLoc, unistr);
+        } else {
+            locale.getDisplayName(*displayLoc, unistr);
         }
-        locale.getDisplayName(displayLoc, unistr);
     }
     if (sentenceCase) {
         UChar32 ch = ucase_toupper(unistr.char32At(0));
@@ -292,6 +313,98 @@ string GetDisplayLanguageInner(const string &language, const string &displayLoca
     return out;
 }
 
+string ComputeDisplayRegion(const string &region, bool validRegion, const icu::Locale *displayLoc, bool sentenceCase)
+{
+    if (!displayLoc) {
+        return "";
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    icu::Locale originLocale;
+    if (validRegion) {
+        icu::LocaleBuilder builder = icu::LocaleBuilder().setRegion(region);
+        originLocale = builder.build(status);
+    } else {
+        originLocale = icu::Locale::forLanguageTag(region, status);
+        string maximized;
+        if (status != U_ZERO_ERROR || !LikelySubtags::Maximize(originLocale.getBaseName(), maximized)) {
+            return "";
+        }
+        originLocale = icu::Locale(maximized.c_str());
+    }
+    if (status != U_ZERO_ERROR) {
+        return "";
+    }
+    icu::UnicodeString displayRegion;
+    originLocale.getDisplayCountry(*displayLoc, displayRegion);
+    if (sentenceCase) {
+        UChar32 ch = ucase_toupper(displayRegion.char32At(0));
+        displayRegion.replace(0, 1, ch);
+    }
+    string temp;
+    displayRegion.toUTF8String(temp);
+    return temp;
+}
+
+using DisplayNameFunc = string (*)(const string &item, const icu::Locale *displayLoc, bool sentenceCase);
+
+// Looks up display names of items in cache, the display locale is parsed at most once per call.
+void GetCachedDisplayNames(unordered_map<string, DisplayNames> &cache, const vector<string> &items,
+    const string &displayLocale, bool sentenceCase, DisplayNameFunc func, vector<string> &result)
+{
+    result.clear();
+    result.reserve(items.size());
+    lock_guard<mutex> lock(g_displayNamesMutex);
+    if (cache.size() >= MAX_DISPLAY_LOCALES && cache.find(displayLocale) == cache.end()) {
+        cache.clear();
+    }
+    unordered_map<string, string> &names = cache[displayLocale].names[sentenceCase ? 1 : 0];
+    bool parsed = false;
+    icu::Locale displayLoc;
+    bool displayLocValid = false;
+    for (const string &item : items) {
+        auto iter = names.find(item);
+        if (iter != names.end()) {
+            result.push_back(iter->second);
+            continue;
+        }
+        if (!parsed) {
+            UErrorCode status = U_ZERO_ERROR;
+            displayLoc = icu::Locale::forLanguageTag(displayLocale, status);
+            displayLocValid = (status == U_ZERO_ERROR);
+            parsed = true;
+        }
+        string name = func(item, displayLocValid ? &displayLoc : nullptr, sentenceCase);
+        if (names.size() >= MAX_DISPLAY_NAMES) {
+            names.clear();
+        }
+        names.emplace(item, name);
+        result.push_back(name);
+    }
+}
+
+void SortByDisplayName(const vector<string> &items, const vector<string> &names, const string &displayLocale,
+    vector<pair<string, string>> &result)
+{
+    result.clear();
+    result.reserve(items.size());
+    for (size_t i = 0; i < items.size() && i < names.size(); ++i) {
+        result.emplace_back(items[i], names[i]);
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    icu::Locale locale = icu::Locale::forLanguageTag(displayLocale, status);
+    unique_ptr<icu::Collator> collator(icu::Collator::createInstance(locale, status));
+    if (U_FAILURE(status) || !collator) {
+        stable_sort(result.begin(), result.end(),
+            [](const pair<string, string> &a, const pair<string, string> &b) { return a.second < b.second; });
+        return;
+    }
+    stable_sort(result.begin(), result.end(),
+        [&collator](const pair<string, string> &a, const pair<string, string> &b) {
+            UErrorCode error = U_ZERO_ERROR;
+            return collator->compareUTF8(a.second, b.second, error) == UCOL_LESS;
+        });
+}
+
 bool LocaleConfig::listsInitialized = LocaleConfig::InitializeLists();
 
 string LocaleConfig::GetSystemLanguage()
@@ -397,12 +510,12 @@ bool LocaleConfig::SetSystemRegion(const string &region)
             return false;
         }
     } else {
-        icu::Locale temp("", region.c_str());
-        UErrorCode status = U_ZERO_ERROR;
-        temp.addLikelySubtags(status);
-        if (status != U_ZERO_ERROR) {
+        string maximized;
+        if (!LikelySubtags::Maximize(icu::Locale("", region.c_str()).getBaseName(), maximized)) {
             return false;
         }
+        icu::Locale temp(maximized.c_str());
+        UErrorCode status = U_ZERO_ERROR;
         newLocale = temp.toLanguageTag<string>(status);
         if (status != U_ZERO_ERROR) {
             return false;
@@ -522,67 +635,69 @@ void LocaleConfig::GetSystemCountries(vector<string> &ret)
 
 bool LocaleConfig::IsSuggested(const string &language)
 {
-    unordered_set<string> relatedLocales;
     vector<string> simCountries;
     GetCountriesFromSim(simCountries);
-    GetRelatedLocales(relatedLocales, simCountries);
-    for (auto iter = relatedLocales.begin(); iter != relatedLocales.end();) {
-        if (whiteLanguages.find(*iter) == whiteLanguages.end()) {
-            iter = relatedLocales.erase(iter);
-        } else {
-            ++iter;
-        }
-    }
-    string mainLanguage = GetMainLanguage(language);
-    return relatedLocales.find(mainLanguage) != relatedLocales.end();
+    return IsSuggestedInCountries(language, simCountries);
 }
 
 bool LocaleConfig::IsSuggested(const std::string &language, const std::string &region)
 {
-    unordered_set<string> relatedLocales;
     vector<string> countries { region };
-    GetRelatedLocales(relatedLocales, countries);
-    for (auto iter = relatedLocales.begin(); iter != relatedLocales.end();) {
-        if (whiteLanguages.find(*iter) == whiteLanguages.end()) {
-            iter = relatedLocales.erase(iter);
-        } else {
-            ++iter;
+    return IsSuggestedInCountries(language, countries);
+}
+
+bool LocaleConfig::IsSuggestedInCountries(const string &language, const vector<string> &countries)
+{
+    call_once(suggestedLanguagesFlag, InitializeSuggestedLanguages);
+    string mainLanguage = GetSuggestedMainLanguage(language);
+    if (mainLanguage.empty()) {
+        return false;
+    }
+    for (const string &country : countries) {
+        auto iter = suggestedLanguages.find(country);
+        if (iter != suggestedLanguages.end() && iter->second.count(mainLanguage) != 0) {
+            return true;
         }
     }
-    string mainLanguage = GetMainLanguage(language);
-    return relatedLocales.find(mainLanguage) != relatedLocales.end();
+    return false;
 }
 
-void LocaleConfig::GetRelatedLocales(unordered_set<string> &relatedLocales, vector<string> countries)
+void LocaleConfig::InitializeSuggestedLanguages()
 {
-    // remove unsupported countries
     const unordered_set<string> &regions = GetSupportedRegions();
-    for (auto iter = countries.begin(); iter != countries.end();) {
-        if (regions.find(*iter) == regions.end()) {
-            iter = countries.erase(iter);
-        } else {
-            ++iter;
-        }
-    }
     const unordered_set<string> &locales = GetSupportedLocales();
-    for (string locale : locales) {
-        bool find = false;
-        for (string country : countries) {
-            if (locale.find(country) != string::npos) {
-                find = true;
-                break;
+    for (const string &locale : locales) {
+        string mainLanguage;
+        for (const string &region : regions) {
+            if (locale.find(region) == string::npos) {
+                continue;
             }
-        }
-        if (!find) {
-            continue;
-        }
-        string mainLanguage = GetMainLanguage(locale);
-        if (mainLanguage != "") {
-            relatedLocales.insert(mainLanguage);
+            if (mainLanguage.empty()) {
+                mainLanguage = GetMainLanguage(locale);
+                if (mainLanguage.empty() || whiteLanguages.find(mainLanguage) == whiteLanguages.end()) {
+                    break;
+                }
+            }
+            suggestedLanguages[region].insert(mainLanguage);
         }
     }
 }
 
+string LocaleConfig::GetSuggestedMainLanguage(const string &language)
+{
+    lock_guard<mutex> lock(mainLanguagesMutex);
+    auto iter = mainLanguages.find(language);
+    if (iter != mainLanguages.end()) {
+        return iter->second;
+    }
+    string mainLanguage = GetMainLanguage(language);
+    if (mainLanguages.size() >= MAIN_LANGUAGES_CACHE_SIZE) {
+        mainLanguages.clear();
+    }
+    mainLanguages.emplace(language, mainLanguage);
+    return mainLanguage;
+}
+
 void LocaleConfig::GetCountriesFromSim(vector<string> &simCountries)
 {
     simCountries.push_back(GetSystemRegion());
@@ -672,12 +787,13 @@ string LocaleConfig::GetMainLanguage(const string &language)
     if (status != U_ZERO_ERROR) {
         return "";
     }
-    origin.addLikelySubtags(status);
-    if (status != U_ZERO_ERROR) {
+    string maximized;
+    if (!LikelySubtags::Maximize(origin.getBaseName(), maximized)) {
         return "";
     }
-    icu::LocaleBuilder builder = icu::LocaleBuilder().setLanguage(origin.getLanguage()).
-        setScript(origin.getScript()).setRegion(origin.getCountry());
+    icu::Locale likely(maximized.c_str());
+    icu::LocaleBuilder builder = icu::LocaleBuilder().setLanguage(likely.getLanguage()).
+        setScript(likely.getScript()).setRegion(likely.getCountry());
     icu::Locale temp = builder.setExtension('u', "").build(status);
     string fullLanguage = temp.toLanguageTag<string>(status);
     if (status != U_ZERO_ERROR) {
@@ -697,57 +813,45 @@ string LocaleConfig::GetMainLanguage(const string &language)
 
 string LocaleConfig::GetDisplayLanguage(const string &language, const string &displayLocale, bool sentenceCase)
 {
-    string adjust = Adjust(language);
-    if (adjust == language) {
-        UErrorCode status = U_ZERO_ERROR;
-        icu::Locale displayLoc = icu::Locale::forLanguageTag(displayLocale, status);
-        if (status != U_ZERO_ERROR) {
-            return "";
-        }
-        icu::Locale locale = icu::Locale::forLanguageTag(language, status);
-        if (status != U_ZERO_ERROR) {
-            return "";
-        }
-        icu::UnicodeString unistr;
-        locale.getDisplayLanguage(displayLoc, unistr);
-        if (sentenceCase) {
-            UChar32 ch = ucase_toupper(unistr.char32At(0));
-            unistr.replace(0, 1, ch);
-        }
-        string out;
-        unistr.toUTF8String(out);
-        return out;
-    }
-    return GetDisplayLanguageInner(adjust, displayLocale, sentenceCase);
+    vector<string> names = GetDisplayLanguages({ language }, displayLocale, sentenceCase);
+    return names.empty() ? "" : names[0];
 }
 
 string LocaleConfig::GetDisplayRegion(const string &region, const string &displayLocale, bool sentenceCase)
 {
-    UErrorCode status = U_ZERO_ERROR;
-    icu::Locale originLocale;
-    if (IsValidRegion(region)) {
-        icu::LocaleBuilder builder = icu::LocaleBuilder().setRegion(region);
-        originLocale = builder.build(status);
-    } else {
-        originLocale = icu::Locale::forLanguageTag(region, status);
-        originLocale.addLikelySubtags(status);
-    }
-    if (status != U_ZERO_ERROR) {
-        return "";
-    }
-    icu::Locale locale = icu::Locale::forLanguageTag(displayLocale, status);
-    if (status != U_ZERO_ERROR) {
-        return "";
-    }
-    icu::UnicodeString displayRegion;
-    originLocale.getDisplayCountry(locale, displayRegion);
-    if (sentenceCase) {
-        UChar32 ch = ucase_toupper(displayRegion.char32At(0));
-        displayRegion.replace(0, 1, ch);
-    }
-    string temp;
-    displayRegion.toUTF8String(temp);
-    return temp;
+    vector<string> names = GetDisplayRegions({ region }, displayLocale, sentenceCase);
+    return names.empty() ? "" : names[0];
+}
+
+vector<string> LocaleConfig::GetDisplayLanguages(const vector<string> &languages, const string &displayLocale,
+    bool sentenceCase)
+{
+    vector<string> result;
+    GetCachedDisplayNames(g_displayLanguages, languages, displayLocale, sentenceCase, ComputeDisplayLanguage, result);
+    return result;
+}
+
+vector<string> LocaleConfig::GetDisplayRegions(const vector<string> &regions, const string &displayLocale,
+    bool sentenceCase)
+{
+    DisplayNameFunc func = [](const string &region, const icu::Locale *displayLoc, bool sentence) {
+        return ComputeDisplayRegion(region, IsValidRegion(region), displayLoc, sentence);
+    };
+    vector<string> result;
+    GetCachedDisplayNames(g_displayRegions, regions, displayLocale, sentenceCase, func, result);
+    return result;
+}
+
+void LocaleConfig::GetSortedDisplayLanguages(const vector<string> &languages, const string &displayLocale,
+    bool sentenceCase, vector<pair<string, string>> &result)
+{
+    SortByDisplayName(languages, GetDisplayLanguages(languages, displayLocale, sentenceCase), displayLocale, result);
+}
+
+void LocaleConfig::GetSortedDisplayRegions(const vector<string> &regions, const string &displayLocale,
+    bool sentenceCase, vector<pair<string, string>> &result)
+{
+    SortByDisplayName(regions, GetDisplayRegions(regions, displayLocale, sentenceCase), displayLocale, result);
 }
 
 bool LocaleConfig::IsRTL(const string &locale)
@@ -14,7 +14,11 @@
  */
 #include "locale_info.h"
 #include <algorithm>
+#include <bitset>
+#include <cstring>
+#include <unordered_map>
 #include "ohos/init_data.h"
+#include "likely_subtags.h"
 #include "locale_config.h"
 
 namespace OHOS {
@@ -22,84 +26,184 @@ namespace Global {
 namespace I18n {
 using namespace icu;
 
-std::set<std::string> LocaleInfo::allValidLocales = GetValidLocales();
+static constexpr size_t LETTER_COUNT = 26;
+static constexpr size_t TWO_LETTER_CODES = LETTER_COUNT * LETTER_COUNT;
+static constexpr size_t LANGUAGE_CODES = TWO_LETTER_CODES + TWO_LETTER_CODES * LETTER_COUNT;
 
-std::set<std::string> LocaleInfo::GetValidLocales()
+// Maps a 2 or 3 lowercase letter language code to a slot in [0, LANGUAGE_CODES), or returns LANGUAGE_CODES.
+static size_t GetLanguageCodeIndex(const char *language)
 {
+    if (language == nullptr) {
+        return LANGUAGE_CODES;
+    }
+    size_t index = 0;
+    size_t len = 0;
+    for (; language[len] != '\0'; ++len) {
+        // 3 is the max length of language codes stored in the bitset
+        if (len == 3 || language[len] < 'a' || language[len] > 'z') {
+            return LANGUAGE_CODES;
+        }
+        index = index * LETTER_COUNT + static_cast<size_t>(language[len] - 'a');
+    }
+    // 2 is the min length of language codes
+    if (len < 2) {
+        return LANGUAGE_CODES;
+    }
+    return (len == 2) ? index : TWO_LETTER_CODES + index;
+}
+
+static std::bitset<LANGUAGE_CODES> BuildValidLanguages()
+{
+    std::bitset<LANGUAGE_CODES> validLanguages;
     int32_t validCount = 1;
     const Locale *validLocales = Locale::getAvailableLocales(validCount);
-    std::set<std::string> allValidLocales;
     for (int i = 0; i < validCount; i++) {
-        allValidLocales.insert(validLocales[i].getLanguage());
+        size_t index = GetLanguageCodeIndex(validLocales[i].getLanguage());
+        if (index < LANGUAGE_CODES) {
+            validLanguages.set(index);
+        }
+    }
+    for (const char *language : { "in", "iw", "tl" }) {
+        validLanguages.set(GetLanguageCodeIndex(language));
     }
-    allValidLocales.insert("in");
-    allValidLocales.insert("iw");
-    allValidLocales.insert("tl");
-    return allValidLocales;
+    return validLanguages;
+}
+
+bool LocaleInfo::IsValidLanguage(const char *language)
+{
+    static const std::bitset<LANGUAGE_CODES> validLanguages = BuildValidLanguages();
+    size_t index = GetLanguageCodeIndex(language);
+    return index < LANGUAGE_CODES && validLanguages.test(index);
+}
+
+static const char *g_extensionTags[] = { "-hc-", "-nu-", "-ca-", "-co-", "-kf-", "-kn-" };
+static const char *g_extensionConfigs[] = {
+    "hourCycle", "numberingSystem", "calendar", "collation", "caseFirst", "numeric"
+};
+// Well-known unicode extension values, id 0 is reserved for the empty value.
+static const char *g_extensionValues[] = {
+    "",
+    "h11", "h12", "h23", "h24",
+    "true", "false", "upper", "lower",
+    "buddhist", "chinese", "coptic", "dangi", "ethioaa", "ethiopic", "gregory", "hebrew", "indian", "islamic",
+    "islamic-umalqura", "islamic-tbla", "islamic-civil", "islamic-rgsa", "iso8601", "japanese", "persian", "roc",
+    "islamicc",
+    "big5han", "compat", "dict", "direct", "ducet", "emoji", "eor", "gb2312", "phonebk", "phonetic", "pinyin",
+    "reformed", "search", "searchjl", "standard", "stroke", "trad", "unihan", "zhuyin",
+    "adlm", "ahom", "arab", "arabext", "bali", "beng", "bhks", "brah", "cakm", "cham", "deva", "diak",
+    "fullwide", "gong", "gonm", "gujr", "guru", "hanidec", "hmng", "hmnp", "java", "kali", "khmr", "knda",
+    "lana", "lanatham", "laoo", "latn", "lepc", "limb", "mathbold", "mathdbl", "mathmono", "mathsanb", "mathsans",
+    "mlym", "modi", "mong", "mroo", "mtei", "mymr", "mymrshan", "mymrtlng", "newa", "nkoo", "olck", "orya", "osma",
+    "rohg", "saur", "segment", "shrd", "sind", "sinh", "sora", "sund", "takr", "talu", "tamldec", "telu",
+    "thai", "tibt", "tirh", "vaii", "wara", "wcho",
+};
+static constexpr uint8_t EXTRA_SUBTAG_BASE = 0x80;
+static constexpr size_t MAX_LANGUAGE_LEN = 8;
+static constexpr size_t MAX_REGION_LEN = 3;
+
+static uint64_t PackSubtag(const char *subtag, size_t maxLen)
+{
+    if (subtag == nullptr) {
+        return 0;
+    }
+    size_t len = strlen(subtag);
+    if (len > maxLen) {
+        return 0;
+    }
+    uint64_t code = 0;
+    for (size_t i = 0; i < len; ++i) {
+        code |= static_cast<uint64_t>(static_cast<uint8_t>(subtag[i])) << (i * 8); // 8 bits per character
+    }
+    return code;
+}
+
+static std::string UnpackSubtag(uint64_t code)
+{
+    std::string subtag;
+    while (code != 0) {
+        subtag.push_back(static_cast<char>(code & 0xFF));
+        code >>= 8; // 8 bits per character
+    }
+    return subtag;
+}
+
+static uint8_t FindExtensionValue(const std::string &value)
+{
+    static const std::unordered_map<std::string, uint8_t> valueIds = [] {
+        std::unordered_map<std::string, uint8_t> ids;
+        for (size_t i = 1; i < sizeof(g_extensionValues) / sizeof(g_extensionValues[0]); ++i) {
+            ids.insert(std::make_pair(g_extensionValues[i], static_cast<uint8_t>(i)));
+        }
+        return ids;
+    }();
+    auto iter = valueIds.find(value);
+    return (iter == valueIds.end()) ? 0 : iter->second;
 }
 
 LocaleInfo::LocaleInfo(std::string localeTag)
 {
     UErrorCode status = U_ZERO_ERROR;
-    configs = {};
-    ComputeFinalLocaleTag(localeTag);
+    ComputeFinalLocaleTag(localeTag, {});
     std::unique_ptr<icu::LocaleBuilder> builder = nullptr;
     builder = std::make_unique<LocaleBuilder>();
-    Locale locale = builder->setLanguageTag(StringPiece(localeTag)).build(status);
+    Locale tagLocale = builder->setLanguageTag(StringPiece(localeTag)).build(status);
     if (status != U_ZERO_ERROR) {
         std::string defaultLocaleTag = LocaleConfig::GetSystemLocale();
         Locale defaultLocale(defaultLocaleTag.c_str());
-        locale = defaultLocale;
+        tagLocale = defaultLocale;
 
         finalLocaleTag = "";
-        ComputeFinalLocaleTag(defaultLocaleTag);
-    }
-    language = locale.getLanguage();
-    script = locale.getScript();
-    region = locale.getCountry();
-    baseName = language;
-    if (script.length() == SCRIPT_LEN) {
-        baseName += "-" + script;
-    }
-    if (region.length() == REGION_LEN) {
-        baseName += "-" + region;
+        ComputeFinalLocaleTag(defaultLocaleTag, {});
     }
+    SetSubtags(tagLocale);
 }
 
 LocaleInfo::LocaleInfo(const std::string &localeTag, std::map<std::string, std::string> &configMap)
 {
     UErrorCode status = U_ZERO_ERROR;
-    configs = configMap;
     std::unique_ptr<icu::LocaleBuilder> builder = nullptr;
     builder = std::make_unique<LocaleBuilder>();
+    Locale tagLocale;
     if (localeTag != "") {
-        ComputeFinalLocaleTag(localeTag);
-        locale = builder->setLanguageTag(StringPiece(finalLocaleTag)).build(status);
+        ComputeFinalLocaleTag(localeTag, configMap);
+        tagLocale = builder->setLanguageTag(StringPiece(finalLocaleTag)).build(status);
     }
     if (status != U_ZERO_ERROR || localeTag == "") {
         std::string defaultLocaleTag = LocaleConfig::GetSystemLocale();
         finalLocaleTag = "";
-        ComputeFinalLocaleTag(defaultLocaleTag);
-        locale = builder->setLanguageTag(StringPiece(finalLocaleTag)).build(status);
+        ComputeFinalLocaleTag(defaultLocaleTag, configMap);
+        tagLocale = builder->setLanguageTag(StringPiece(finalLocaleTag)).build(status);
     }
-    language = locale.getLanguage();
-    script = locale.getScript();
-    region = locale.getCountry();
-    baseName = locale.getBaseName();
-    std::replace(baseName.begin(), baseName.end(), '_', '-');
+    fullBaseName = true;
+    SetSubtags(tagLocale);
 }
 
 LocaleInfo::~LocaleInfo() {}
 
-void LocaleInfo::ComputeFinalLocaleTag(const std::string &localeTag)
+void LocaleInfo::SetSubtags(const icu::Locale &locale)
+{
+    languageCode = PackSubtag(locale.getLanguage(), MAX_LANGUAGE_LEN);
+    scriptCode = static_cast<uint32_t>(PackSubtag(locale.getScript(), SCRIPT_LEN));
+    regionCode = static_cast<uint32_t>(PackSubtag(locale.getCountry(), MAX_REGION_LEN));
+    const char *variant = locale.getVariant();
+    if (variant != nullptr && strlen(variant) > 0) {
+        std::string variantTag(variant);
+        std::replace(variantTag.begin(), variantTag.end(), '_', '-');
+        variantId = InternSubtag(variantTag);
+    }
+}
+
+void LocaleInfo::ComputeFinalLocaleTag(const std::string &localeTag, const std::map<std::string, std::string> &configs)
 {
+    std::string script;
+    std::string region;
     if (localeTag.find("-u-") == std::string::npos) {
         finalLocaleTag = localeTag;
-        ParseConfigs();
+        ParseConfigs(configs, script, region);
     } else {
         finalLocaleTag = localeTag.substr(0, localeTag.find("-u-"));
         ParseLocaleTag(localeTag);
-        ParseConfigs();
+        ParseConfigs(configs, script, region);
     }
     if (!script.empty()) {
         finalLocaleTag += "-" + script;
@@ -107,137 +211,160 @@ void LocaleInfo::ComputeFinalLocaleTag(const std::string &localeTag)
     if (!region.empty()) {
         finalLocaleTag += "-" + region;
     }
-    if (!hourCycle.empty() || !numberingSystem.empty() || !calendar.empty() || !collation.empty() ||
-        !caseFirst.empty() || !numeric.empty()) {
-        finalLocaleTag += "-u";
-    }
-    if (!hourCycle.empty()) {
-        finalLocaleTag += hourCycleTag + hourCycle;
-    }
-    if (!numberingSystem.empty()) {
-        finalLocaleTag += numberingSystemTag + numberingSystem;
-    }
-    if (!calendar.empty()) {
-        finalLocaleTag += calendarTag + calendar;
-    }
-    if (!collation.empty()) {
-        finalLocaleTag += collationTag + collation;
-    }
-    if (!caseFirst.empty()) {
-        finalLocaleTag += caseFirstTag + caseFirst;
-    }
-    if (!numeric.empty()) {
-        finalLocaleTag += numericTag + numeric;
+    bool hasExtension = false;
+    for (uint8_t key = 0; key < EXTENSION_COUNT; ++key) {
+        if (extensions[key] == 0) {
+            continue;
+        }
+        if (!hasExtension) {
+            finalLocaleTag += "-u";
+            hasExtension = true;
+        }
+        finalLocaleTag += g_extensionTags[key] + GetSubtag(extensions[key]);
     }
 }
 
 void LocaleInfo::ParseLocaleTag(const std::string &localeTag)
 {
     std::string flag = "-";
-    if (localeTag.find(hourCycleTag) != std::string::npos) {
-        hourCycle = localeTag.substr(localeTag.find(hourCycleTag) + CONFIG_TAG_LEN);
-        hourCycle = hourCycle.substr(0, hourCycle.find(flag));
-    }
-    if (localeTag.find(numberingSystemTag) != std::string::npos) {
-        numberingSystem = localeTag.substr(localeTag.find(numberingSystemTag) + CONFIG_TAG_LEN);
-        numberingSystem = numberingSystem.substr(0, numberingSystem.find(flag));
-    }
-    if (localeTag.find(calendarTag) != std::string::npos) {
-        calendar = localeTag.substr(localeTag.find(calendarTag) + CONFIG_TAG_LEN);
-        calendar = calendar.substr(0, calendar.find(flag));
-    }
-    if (localeTag.find(collationTag) != std::string::npos) {
-        collation = localeTag.substr(localeTag.find(collationTag) + CONFIG_TAG_LEN);
-        collation = collation.substr(0, collation.find(flag));
-    }
-    if (localeTag.find(caseFirstTag) != std::string::npos) {
-        caseFirst = localeTag.substr(localeTag.find(caseFirstTag) + CONFIG_TAG_LEN);
-        caseFirst = caseFirst.substr(0, caseFirst.find(flag));
-    }
-    if (localeTag.find(numericTag) != std::string::npos) {
-        numeric = localeTag.substr(localeTag.find(numericTag) + CONFIG_TAG_LEN);
-        numeric = numeric.substr(0, numeric.find(flag));
+    for (uint8_t key = 0; key < EXTENSION_COUNT; ++key) {
+        std::string::size_type pos = localeTag.find(g_extensionTags[key]);
+        if (pos != std::string::npos) {
+            std::string value = localeTag.substr(pos + CONFIG_TAG_LEN);
+            SetExtension(static_cast<ExtensionKey>(key), value.substr(0, value.find(flag)));
+        }
     }
 }
 
-void LocaleInfo::ParseConfigs()
+void LocaleInfo::ParseConfigs(const std::map<std::string, std::string> &configs, std::string &script,
+    std::string &region)
 {
     if (configs.count("script") > 0) {
-        script = configs["script"];
+        script = configs.at("script");
     }
     if (configs.count("region") > 0) {
-        region = configs["region"];
+        region = configs.at("region");
     }
-    if (configs.count("hourCycle") > 0) {
-        hourCycle = configs["hourCycle"];
+    for (uint8_t key = 0; key < EXTENSION_COUNT; ++key) {
+        auto iter = configs.find(g_extensionConfigs[key]);
+        if (iter != configs.end()) {
+            SetExtension(static_cast<ExtensionKey>(key), iter->second);
+        }
     }
-    if (configs.count("numberingSystem") > 0) {
-        numberingSystem = configs["numberingSystem"];
+}
+
+void LocaleInfo::SetExtension(ExtensionKey key, const std::string &value)
+{
+    extensions[key] = InternSubtag(value);
+}
+
+std::string LocaleInfo::GetExtension(ExtensionKey key) const
+{
+    return GetSubtag(extensions[key]);
+}
+
+uint8_t LocaleInfo::InternSubtag(const std::string &value)
+{
+    if (value.empty()) {
+        return 0;
     }
-    if (configs.count("calendar") > 0) {
-        calendar = configs["calendar"];
+    uint8_t id = FindExtensionValue(value);
+    if (id != 0) {
+        return id;
     }
-    if (configs.count("collation") > 0) {
-        collation = configs["collation"];
+    for (size_t i = 0; i < extraSubtags.size(); ++i) {
+        if (extraSubtags[i] == value) {
+            return static_cast<uint8_t>(EXTRA_SUBTAG_BASE + i);
+        }
     }
-    if (configs.count("caseFirst") > 0) {
-        caseFirst = configs["caseFirst"];
+    if (extraSubtags.size() >= EXTRA_SUBTAG_BASE) {
+        return 0;
     }
-    if (configs.count("numeric") > 0) {
-        numeric = configs["numeric"];
+    extraSubtags.push_back(value);
+    return static_cast<uint8_t>(EXTRA_SUBTAG_BASE + extraSubtags.size() - 1);
+}
+
+std::string LocaleInfo::GetSubtag(uint8_t id) const
+{
+    if (id < EXTRA_SUBTAG_BASE) {
+        return (id < sizeof(g_extensionValues) / sizeof(g_extensionValues[0])) ? g_extensionValues[id] : "";
     }
+    size_t index = id - EXTRA_SUBTAG_BASE;
+    return (index < extraSubtags.size()) ? extraSubtags[index] : "";
 }
 
 bool LocaleInfo::icuInitialized = LocaleInfo::Init();
 
 std::string LocaleInfo::GetLanguage() const
 {
-    return language;
+    return UnpackSubtag(languageCode);
 }
 
 std::string LocaleInfo::GetScript() const
 {
-    return script;
+    return UnpackSubtag(scriptCode);
 }
 
 std::string LocaleInfo::GetRegion() const
 {
-    return region;
+    return UnpackSubtag(regionCode);
 }
 
 std::string LocaleInfo::GetBaseName() const
 {
+    std::string baseName = GetLanguage();
+    std::string script = GetScript();
+    std::string region = GetRegion();
+    if (!fullBaseName) {
+        if (script.length() == SCRIPT_LEN) {
+            baseName += "-" + script;
+        }
+        if (region.length() == REGION_LEN) {
+            baseName += "-" + region;
+        }
+        return baseName;
+    }
+    // same layout as icu::Locale::getBaseName() with '_' replaced by '-'
+    if (!script.empty()) {
+        baseName += "-" + script;
+    }
+    if (!region.empty() || variantId != 0) {
+        baseName += "-" + region;
+    }
+    if (variantId != 0) {
+        baseName += "-" + GetSubtag(variantId);
+    }
     return baseName;
 }
 
 std::string LocaleInfo::GetCalendar() const
 {
-    return calendar;
+    return GetExtension(CALENDAR);
 }
 
 std::string LocaleInfo::GetCollation() const
 {
-    return collation;
+    return GetExtension(COLLATION);
 }
 
 std::string LocaleInfo::GetHourCycle() const
 {
-    return hourCycle;
+    return GetExtension(HOUR_CYCLE);
 }
 
 std::string LocaleInfo::GetNumberingSystem() const
 {
-    return numberingSystem;
+    return GetExtension(NUMBERING_SYSTEM);
 }
 
 std::string LocaleInfo::GetNumeric() const
 {
-    return numeric;
+    return GetExtension(NUMERIC);
 }
 
 std::string LocaleInfo::GetCaseFirst() const
 {
-    return caseFirst;
+    return GetExtension(CASE_FIRST);
 }
 
 std::string LocaleInfo::ToString() const
@@ -245,45 +372,62 @@ std::string LocaleInfo::ToString() const
     return finalLocaleTag;
 }
 
-Locale LocaleInfo::GetLocale() const
+const Locale &LocaleInfo::GetLocale() const
 {
-    return locale;
+    if (locale == nullptr) {
+        UErrorCode status = U_ZERO_ERROR;
+        LocaleBuilder builder;
+        locale = std::make_unique<Locale>(builder.setLanguageTag(StringPiece(finalLocaleTag)).build(status));
+        if (status != U_ZERO_ERROR) {
+            *locale = Locale(finalLocaleTag.c_str());
+        }
+    }
+    return *locale;
 }
 
 std::string LocaleInfo::Maximize()
 {
-    UErrorCode status = U_ZERO_ERROR;
-    Locale curLocale = locale;
-    curLocale.addLikelySubtags(status);
-    if (status == U_ZERO_ERROR) {
-        std::string restConfigs = "";
-        if (finalLocaleTag.find("-u-") != std::string::npos) {
-            restConfigs = finalLocaleTag.substr(finalLocaleTag.find("-u-"));
-        }
-        std::string curBaseName = (!curLocale.getBaseName()) ? "" : curLocale.getBaseName();
-        std::replace(curBaseName.begin(), curBaseName.end(), '_', '-');
-        std::string localeTag = curBaseName + restConfigs;
-        return localeTag;
-    }
-    return finalLocaleTag;
+    return ComputeLikelyTag(true);
 }
 
 std::string LocaleInfo::Minimize()
 {
-    UErrorCode status = U_ZERO_ERROR;
-    Locale curLocale = locale;
-    curLocale.minimizeSubtags(status);
-    if (status == U_ZERO_ERROR) {
-        std::string restConfigs = "";
-        if (finalLocaleTag.find("-u-") != std::string::npos) {
-            restConfigs = finalLocaleTag.substr(finalLocaleTag.find("-u-"));
-        }
-        std::string curBaseName = (!curLocale.getBaseName()) ? "" : curLocale.getBaseName();
-        std::replace(curBaseName.begin(), curBaseName.end(), '_', '-');
-        std::string localeTag = curBaseName + restConfigs;
-        return localeTag;
+    return ComputeLikelyTag(false);
+}
+
+std::string LocaleInfo::GetIcuBaseName() const
+{
+    std::string baseName = GetLanguage();
+    std::string script = GetScript();
+    std::string region = GetRegion();
+    if (!script.empty()) {
+        baseName += "_" + script;
     }
-    return finalLocaleTag;
+    if (!region.empty() || variantId != 0) {
+        baseName += "_" + region;
+    }
+    if (variantId != 0) {
+        std::string variant = GetSubtag(variantId);
+        std::replace(variant.begin(), variant.end(), '-', '_');
+        baseName += "_" + variant;
+    }
+    return baseName;
+}
+
+std::string LocaleInfo::ComputeLikelyTag(bool maximize)
+{
+    std::string curBaseName;
+    bool success = maximize ? LikelySubtags::Maximize(GetIcuBaseName(), curBaseName) :
+        LikelySubtags::Minimize(GetIcuBaseName(), curBaseName);
+    if (!success) {
+        return finalLocaleTag;
+    }
+    std::string restConfigs = "";
+    if (finalLocaleTag.find("-u-") != std::string::npos) {
+        restConfigs = finalLocaleTag.substr(finalLocaleTag.find("-u-"));
+    }
+    std::replace(curBaseName.begin(), curBaseName.end(), '_', '-');
+    return curBaseName + restConfigs;
 }
 
 bool LocaleInfo::Init()
@@ -65,7 +65,7 @@ NumberFormat::NumberFormat(const std::vector<std::string> &localeTags, std::map<
     for (size_t i = 0; i < localeTags.size(); i++) {
         std::string curLocale = localeTags[i];
         locale = builder->setLanguageTag(icu::StringPiece(curLocale)).build(status);
-        if (LocaleInfo::allValidLocales.count(locale.getLanguage()) > 0) {
+        if (LocaleInfo::IsValidLanguage(locale.getLanguage())) {
             localeInfo = new LocaleInfo(curLocale, configs);
             locale = localeInfo->GetLocale();
             localeBaseName = localeInfo->GetBaseName();
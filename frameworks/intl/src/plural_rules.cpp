@@ -85,7 +85,7 @@ void PluralRules::InitPluralRules(std::vector<std::string> &localeTags,
     for (size_t i = 0; i < localeTags.size(); i++) {
         std::string curLocale = localeTags[i];
         locale = icu::Locale::forLanguageTag(icu::StringPiece(curLocale), status);
-        if (LocaleInfo::allValidLocales.count(locale.getLanguage()) > 0) {
+        if (LocaleInfo::IsValidLanguage(locale.getLanguage())) {
             localeInfo = std::make_unique<LocaleInfo>(curLocale, options);
             locale = localeInfo->GetLocale();
             localeStr = localeInfo->GetBaseName();
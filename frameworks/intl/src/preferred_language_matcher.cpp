@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "preferred_language_matcher.h"
+#include "likely_subtags.h"
+#include "unicode/localematcher.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+PreferredLanguageMatcher::PreferredLanguageMatcher(const std::vector<std::string> &preferredLanguages)
+{
+    for (const std::string &language : preferredLanguages) {
+        UErrorCode status = U_ZERO_ERROR;
+        icu::Locale locale = icu::Locale::forLanguageTag(language, status);
+        if (status != U_ZERO_ERROR || locale.isBogus()) {
+            continue;
+        }
+        std::string maximized;
+        if (LikelySubtags::Maximize(locale.getBaseName(), maximized)) {
+            locale = icu::Locale(maximized.c_str());
+        }
+        preferredLocales.push_back(locale);
+    }
+}
+
+PreferredLanguageMatcher::~PreferredLanguageMatcher()
+{
+}
+
+size_t PreferredLanguageMatcher::GetPreferredCount() const
+{
+    return preferredLocales.size();
+}
+
+int32_t PreferredLanguageMatcher::GetBestMatch(const std::vector<std::string> &resourceLocales) const
+{
+    if (preferredLocales.empty() || resourceLocales.empty()) {
+        return -1;
+    }
+    std::vector<icu::Locale> supported;
+    std::vector<int32_t> indexes;
+    supported.reserve(resourceLocales.size());
+    indexes.reserve(resourceLocales.size());
+    for (size_t i = 0; i < resourceLocales.size(); ++i) {
+        UErrorCode status = U_ZERO_ERROR;
+        icu::Locale locale = icu::Locale::forLanguageTag(resourceLocales[i], status);
+        if (status != U_ZERO_ERROR || locale.isBogus()) {
+            continue;
+        }
+        supported.push_back(locale);
+        indexes.push_back(static_cast<int32_t>(i));
+    }
+    if (supported.empty()) {
+        return -1;
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    icu::LocaleMatcher matcher = icu::LocaleMatcher::Builder().setSupportedLocales(supported.begin(),
+        supported.end()).setNoDefaultLocale().setDemotionPerDesiredLocale(ULOCMATCH_DEMOTION_REGION).build(status);
+    if (U_FAILURE(status)) {
+        return -1;
+    }
+    icu::Locale::RangeIterator<std::vector<icu::Locale>::const_iterator> desired(preferredLocales.begin(),
+        preferredLocales.end());
+    icu::LocaleMatcher::Result result = matcher.getBestMatchResult(desired, status);
+    int32_t index = result.getSupportedIndex();
+    if (U_FAILURE(status) || index < 0 || index >= static_cast<int32_t>(indexes.size())) {
+        return -1;
+    }
+    return indexes[index];
+}
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
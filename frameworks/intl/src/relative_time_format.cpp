@@ -56,7 +56,7 @@ RelativeTimeFormat::RelativeTimeFormat(const std::vector<std::string> &localeTag
     for (size_t i = 0; i < localeTags.size(); i++) {
         std::string curLocale = localeTags[i];
         locale = builder->setLanguageTag(icu::StringPiece(curLocale)).build(status);
-        if (LocaleInfo::allValidLocales.count(locale.getLanguage()) > 0) {
+        if (LocaleInfo::IsValidLanguage(locale.getLanguage())) {
             localeInfo = std::make_unique<LocaleInfo>(curLocale, configs);
             locale = localeInfo->GetLocale();
             localeBaseName = localeInfo->GetBaseName();
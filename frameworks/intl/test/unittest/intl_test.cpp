@@ -14,12 +14,23 @@
  */
 
 #include "intl_test.h"
+#include <algorithm>
+#include <chrono>
 #include <gtest/gtest.h>
 #include <map>
 #include <vector>
+#include "bidi_analyzer.h"
+#include "character.h"
 #include "date_time_format.h"
+#include "i18n_break_iterator.h"
+#include "i18n_break_stream.h"
+#include "i18n_calendar.h"
+#include "i18n_timezone.h"
+#include "index_util.h"
+#include "likely_subtags.h"
 #include "locale_info.h"
 #include "number_format.h"
+#include "preferred_language_matcher.h"
 
 using namespace OHOS::Global::I18n;
 using testing::ext::TestSize;
@@ -463,4 +474,987 @@ HWTEST_F(IntlTest, IntlFuncTest0015, TestSize.Level1)
     EXPECT_EQ(dateFormat->GetTimeZoneName(), "long");
     delete dateFormat;
 }
+/**
+ * @tc.name: IntlFuncTest0016
+ * @tc.desc: Test Intl LocaleInfo keeps well-known and unknown extension values
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0016, TestSize.Level1)
+{
+    string locale = "es-419-u-ca-islamic-co-foo";
+    map<string, string> options = { { "numberingSystem", "latn" },
+                                    { "caseFirst", "upper" } };
+    LocaleInfo *loc = new (std::nothrow) LocaleInfo(locale, options);
+    if (!loc) {
+        EXPECT_TRUE(false);
+        return;
+    }
+    EXPECT_EQ(loc->GetLanguage(), "es");
+    EXPECT_EQ(loc->GetScript(), "");
+    EXPECT_EQ(loc->GetRegion(), "419");
+    EXPECT_EQ(loc->GetBaseName(), "es-419");
+    EXPECT_EQ(loc->GetCalendar(), "islamic");
+    EXPECT_EQ(loc->GetCollation(), "foo");
+    EXPECT_EQ(loc->GetNumberingSystem(), "latn");
+    EXPECT_EQ(loc->GetCaseFirst(), "upper");
+    EXPECT_EQ(loc->ToString(), "es-419-u-nu-latn-ca-islamic-co-foo-kf-upper");
+    EXPECT_EQ(loc->Maximize(), "es-Latn-419-u-nu-latn-ca-islamic-co-foo-kf-upper");
+    delete loc;
+    LocaleInfo info("zh-Hant-TW");
+    EXPECT_EQ(info.Maximize(), "zh-Hant-TW");
+    EXPECT_EQ(info.Minimize(), "zh-TW");
+}
+
+/**
+ * @tc.name: IntlFuncTest0017
+ * @tc.desc: Test Intl LikelySubtags cache
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0017, TestSize.Level1)
+{
+    LikelySubtags::Clear();
+    string result;
+    EXPECT_TRUE(LikelySubtags::Maximize("zh_TW", result));
+    EXPECT_EQ(result, "zh_Hant_TW");
+    EXPECT_TRUE(LikelySubtags::Minimize("zh_Hant_TW", result));
+    EXPECT_EQ(result, "zh_TW");
+    LocaleInfo info("zh-TW-u-ca-chinese");
+    EXPECT_EQ(info.Maximize(), "zh-Hant-TW-u-ca-chinese");
+    EXPECT_EQ(info.Maximize(), "zh-Hant-TW-u-ca-chinese");
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    LikelySubtags::GetStatistics(hits, misses);
+    EXPECT_EQ(hits, 2U);
+    EXPECT_EQ(misses, 2U);
+    LikelySubtags::Clear();
+    LikelySubtags::GetStatistics(hits, misses);
+    EXPECT_EQ(hits + misses, 0U);
+}
+
+/**
+ * @tc.name: IntlFuncTest0018
+ * @tc.desc: Test Intl PreferredLanguageMatcher
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0018, TestSize.Level1)
+{
+    vector<string> preferred = { "zh-Hant-TW", "en-GB", "jessie-" };
+    PreferredLanguageMatcher matcher(preferred);
+    EXPECT_EQ(matcher.GetPreferredCount(), 2U);
+    vector<string> resources = { "fr", "zh-CN", "en", "zh-HK" };
+    EXPECT_EQ(matcher.GetBestMatch(resources), 3);
+    resources = { "fr", "en", "zh-CN" };
+    EXPECT_EQ(matcher.GetBestMatch(resources), 1);
+    resources = { "fr", "de-DE" };
+    EXPECT_EQ(matcher.GetBestMatch(resources), -1);
+    resources = {};
+    EXPECT_EQ(matcher.GetBestMatch(resources), -1);
+}
+
+/**
+ * @tc.name: IntlFuncTest0019
+ * @tc.desc: Test Intl PreferredLanguageMatcher performance over 200 resource locales
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0019, TestSize.Level1)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t count = 0;
+    const icu::Locale *available = icu::Locale::getAvailableLocales(count);
+    vector<string> resources;
+    for (int32_t i = 0; i < count && resources.size() < 200; ++i) {
+        resources.push_back(available[i].toLanguageTag<string>(status));
+    }
+    PreferredLanguageMatcher matcher({ "pt-BR", "es-419", "en-US" });
+    uint64_t total = 0;
+    int32_t index = -1;
+    for (int k = 0; k < 100; ++k) {
+        auto t1 = std::chrono::high_resolution_clock::now();
+        index = matcher.GetBestMatch(resources);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        total += std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+    }
+    EXPECT_TRUE(index >= 0);
+    double average = total / 100.0;
+    EXPECT_LT(average, 2000);
+}
+
+/**
+ * @tc.name: IntlFuncTest0020
+ * @tc.desc: Test Intl LocaleInfo IsValidLanguage
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0020, TestSize.Level1)
+{
+    EXPECT_TRUE(LocaleInfo::IsValidLanguage("en"));
+    EXPECT_TRUE(LocaleInfo::IsValidLanguage("fil"));
+    EXPECT_TRUE(LocaleInfo::IsValidLanguage("iw"));
+    EXPECT_FALSE(LocaleInfo::IsValidLanguage("EN"));
+    EXPECT_FALSE(LocaleInfo::IsValidLanguage("jessie"));
+    EXPECT_FALSE(LocaleInfo::IsValidLanguage(""));
+    EXPECT_FALSE(LocaleInfo::IsValidLanguage(nullptr));
+}
+
+/**
+ * @tc.name: IntlFuncTest0021
+ * @tc.desc: Test Intl Character code point and UTF-8 overloads
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0021, TestSize.Level1)
+{
+    EXPECT_EQ(GetFirstCodePoint("\xe4\xb8\xad\xe6\x96\x87"), 0x4E2D);
+    EXPECT_EQ(GetFirstCodePoint("\xff"), 0xFFFD);
+    EXPECT_EQ(GetFirstCodePoint(""), 0xFFFF);
+    EXPECT_TRUE(IsDigit(0x0661));
+    EXPECT_TRUE(IsDigit("7"));
+    EXPECT_TRUE(IsRTLCharacter(0x05D0));
+    EXPECT_TRUE(IsRTLCharacter("\xd8\xa7"));
+    EXPECT_FALSE(IsRTLCharacter('a'));
+    EXPECT_TRUE(IsIdeoGraphic("\xe4\xb8\xad"));
+    EXPECT_TRUE(IsLetter(0x00E9));
+    EXPECT_TRUE(IsUpperCase('A'));
+    EXPECT_TRUE(IsLowerCase("a"));
+    EXPECT_TRUE(IsSpaceChar(0x3000));
+    EXPECT_TRUE(IsWhiteSpace("\t"));
+    EXPECT_STREQ(GetType(0x4E2D), "U_OTHER_LETTER");
+    EXPECT_EQ(GetType("$"), "U_CURRENCY_SYMBOL");
+}
+
+/**
+ * @tc.name: IntlFuncTest0022
+ * @tc.desc: Test Intl Character bulk classification
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0022, TestSize.Level1)
+{
+    string text = "a1 \xe4\xb8\xad\xd7\x90";
+    vector<uint8_t> classes;
+    GetCharacterClasses(text, classes);
+    ASSERT_EQ(classes.size(), 5U);
+    EXPECT_EQ(classes[0], CHARACTER_CLASS_LETTER | CHARACTER_CLASS_LOWER_CASE);
+    EXPECT_EQ(classes[1], CHARACTER_CLASS_DIGIT);
+    EXPECT_EQ(classes[2], CHARACTER_CLASS_SPACE_CHAR | CHARACTER_CLASS_WHITE_SPACE);
+    EXPECT_EQ(classes[3], CHARACTER_CLASS_IDEOGRAPHIC | CHARACTER_CLASS_LETTER);
+    EXPECT_EQ(classes[4], CHARACTER_CLASS_RTL | CHARACTER_CLASS_LETTER);
+    vector<uint8_t> utf16Classes;
+    GetCharacterClasses(u"a\U0001D400 1", utf16Classes);
+    ASSERT_EQ(utf16Classes.size(), 5U);
+    EXPECT_EQ(utf16Classes[0], CHARACTER_CLASS_LETTER | CHARACTER_CLASS_LOWER_CASE);
+    EXPECT_EQ(utf16Classes[1], CHARACTER_CLASS_LETTER | CHARACTER_CLASS_UPPER_CASE);
+    EXPECT_EQ(utf16Classes[2], utf16Classes[1]);
+    EXPECT_EQ(utf16Classes[4], CHARACTER_CLASS_DIGIT);
+    EXPECT_TRUE(ContainsRTLCharacter(text));
+    EXPECT_FALSE(ContainsRTLCharacter("plain ascii text only"));
+    EXPECT_EQ(CountIdeographs(text), 1);
+    EXPECT_TRUE(IsAllDigits("0123456789\xd9\xa1"));
+    EXPECT_FALSE(IsAllDigits("12a"));
+    EXPECT_FALSE(IsAllDigits(""));
+    EXPECT_EQ(GetFirstStrongDirection("123 \xd7\x90 abc"), UBIDI_RTL);
+    EXPECT_EQ(GetFirstStrongDirection("123 abc"), UBIDI_LTR);
+    EXPECT_EQ(GetFirstStrongDirection("123 !"), UBIDI_NEUTRAL);
+}
+
+/**
+ * @tc.name: IntlFuncTest0023
+ * @tc.desc: Test Intl BidiAnalyzer
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0023, TestSize.Level1)
+{
+    BidiAnalyzer analyzer("ar-EG");
+    EXPECT_EQ(analyzer.GetBaseDirection("123 abc"), UBIDI_LTR);
+    EXPECT_EQ(analyzer.GetBaseDirection("\xd7\x90\xd7\x91 abc"), UBIDI_RTL);
+    EXPECT_EQ(analyzer.GetBaseDirection("123"), UBIDI_RTL);
+    EXPECT_FALSE(analyzer.IsMixedDirection("hello"));
+    EXPECT_TRUE(analyzer.IsMixedDirection("hello \xd7\x90\xd7\x91"));
+    vector<BidiRun> runs;
+    EXPECT_TRUE(analyzer.GetRuns("ab \xd7\x90\xd7\x91", runs));
+    ASSERT_EQ(runs.size(), 2U);
+    EXPECT_EQ(runs[0].start, 0);
+    EXPECT_EQ(runs[0].end, 3);
+    EXPECT_EQ(runs[0].level, 0);
+    EXPECT_EQ(runs[1].start, 3);
+    EXPECT_EQ(runs[1].end, 7);
+    EXPECT_EQ(runs[1].level, 1);
+    EXPECT_TRUE(analyzer.GetRuns("", runs));
+    EXPECT_TRUE(runs.empty());
+}
+
+/**
+ * @tc.name: IntlFuncTest0024
+ * @tc.desc: Test Intl BidiAnalyzer throughput on short strings
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0024, TestSize.Level1)
+{
+    string texts[] = { "See you at 10:30", "\xd7\xa9\xd7\x9c\xd7\x95\xd7\x9d world", "\xe4\xbd\xa0\xe5\xa5\xbd 123" };
+    int count = 3;
+    BidiAnalyzer analyzer("en-US");
+    vector<BidiRun> runs;
+    uint64_t total = 0;
+    for (int k = 0; k < 10000; ++k) {
+        for (int i = 0; i < count; ++i) {
+            auto t1 = std::chrono::high_resolution_clock::now();
+            analyzer.GetBaseDirection(texts[i]);
+            analyzer.GetRuns(texts[i], runs);
+            auto t2 = std::chrono::high_resolution_clock::now();
+            total += std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count();
+        }
+    }
+    double average = total / (10000.0 * count);
+    EXPECT_LT(average, 20000);
+}
+
+/**
+ * @tc.name: IntlFuncTest0025
+ * @tc.desc: Test Intl I18nBreakIterator word, sentence and character types
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0025, TestSize.Level1)
+{
+    I18nBreakIterator wordIterator("en-US", WORD_BREAK);
+    wordIterator.setText("Hello world.");
+    EXPECT_EQ(wordIterator.first(), 0);
+    EXPECT_EQ(wordIterator.next(), 5);
+    EXPECT_EQ(wordIterator.next(), 6);
+    EXPECT_EQ(wordIterator.next(), 11);
+    I18nBreakIterator sentenceIterator("en-US", SENTENCE_BREAK);
+    sentenceIterator.setText("Hi. Bye.");
+    EXPECT_EQ(sentenceIterator.following(0), 4);
+    I18nBreakIterator characterIterator("en-US", CHARACTER_BREAK);
+    characterIterator.setText("e\xcc\x81x");
+    EXPECT_EQ(characterIterator.following(0), 2);
+    I18nBreakIterator lineIterator("en-US");
+    lineIterator.setText("Hello world.");
+    EXPECT_EQ(lineIterator.following(0), 6);
+    uint64_t total = 0;
+    for (int k = 0; k < 1000; ++k) {
+        auto t1 = std::chrono::high_resolution_clock::now();
+        I18nBreakIterator iterator("en-US", WORD_BREAK);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        total += std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+    }
+    double average = total / 1000.0;
+    EXPECT_LT(average, 100);
+}
+
+/**
+ * @tc.name: IntlFuncTest0026
+ * @tc.desc: Test Intl I18nBreakIterator GetAllBoundaries
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0026, TestSize.Level1)
+{
+    I18nBreakIterator iterator("en-US", WORD_BREAK);
+    iterator.setText("Hello world.");
+    iterator.following(3);
+    vector<int32_t> boundaries;
+    vector<int32_t> ruleStatus;
+    iterator.GetAllBoundaries(boundaries, ruleStatus);
+    vector<int32_t> expects = { 0, 5, 6, 11, 12 };
+    EXPECT_EQ(boundaries, expects);
+    ASSERT_EQ(ruleStatus.size(), expects.size());
+    EXPECT_EQ(ruleStatus[1], UBRK_WORD_LETTER);
+    EXPECT_EQ(ruleStatus[2], UBRK_WORD_NONE);
+    EXPECT_EQ(iterator.current(), 5);
+}
+
+/**
+ * @tc.name: IntlFuncTest0027
+ * @tc.desc: Test Intl I18nBreakIterator GetAllBoundaries performance on a long multilingual text
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0027, TestSize.Level1)
+{
+    string paragraph = "The quick brown fox jumps over the lazy dog. "
+        "\xe6\x95\x8f\xe6\x8d\xb7\xe7\x9a\x84\xe6\xa3\x95\xe8\x89\xb2\xe7\x8b\x90\xe7\x8b\xb8\xe3\x80\x82 "
+        "\xd8\xa7\xd9\x84\xd8\xb3\xd9\x84\xd8\xa7\xd9\x85 \xd8\xb9\xd9\x84\xd9\x8a\xd9\x83\xd9\x85. ";
+    string text;
+    while (text.length() < 10240) { // 10240 bytes of text
+        text += paragraph;
+    }
+    I18nBreakIterator iterator("en-US");
+    iterator.setText(text.c_str());
+    vector<int32_t> boundaries;
+    uint64_t total = 0;
+    for (int k = 0; k < 100; ++k) {
+        auto t1 = std::chrono::high_resolution_clock::now();
+        iterator.GetAllBoundaries(boundaries);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        total += std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+    }
+    EXPECT_GT(boundaries.size(), 1000U);
+    double average = total / 100.0;
+    EXPECT_LT(average, 5000);
+}
+
+/**
+ * @tc.name: IntlFuncTest0028
+ * @tc.desc: Test Intl I18nBreakIterator SetUTF8Text and SetUTF16Text
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0028, TestSize.Level1)
+{
+    I18nBreakIterator iterator("en-US");
+    string text = "Hello \xe4\xb8\x96\xe7\x95\x8c";
+    EXPECT_FALSE(iterator.SetUTF8Text(nullptr, 0));
+    EXPECT_TRUE(iterator.SetUTF8Text(text.c_str(), static_cast<int32_t>(text.length())));
+    vector<int32_t> boundaries;
+    iterator.GetAllBoundaries(boundaries);
+    vector<int32_t> expects = { 0, 6, 9, 12 };
+    EXPECT_EQ(boundaries, expects);
+    EXPECT_TRUE(iterator.isBoundary(9));
+    EXPECT_EQ(iterator.following(6), 9);
+    string out;
+    iterator.getText(out);
+    EXPECT_EQ(out, text);
+
+    const char16_t utf16Text[] = u"Hello \u4e16\u754c";
+    EXPECT_TRUE(iterator.SetUTF16Text(utf16Text, -1));
+    iterator.GetAllBoundaries(boundaries);
+    expects = { 0, 6, 7, 8 };
+    EXPECT_EQ(boundaries, expects);
+    out.clear();
+    iterator.getText(out);
+    EXPECT_EQ(out, text);
+
+    iterator.setText(text.c_str());
+    iterator.GetAllBoundaries(boundaries);
+    EXPECT_EQ(boundaries, expects);
+}
+
+/**
+ * @tc.name: IntlFuncTest0029
+ * @tc.desc: Test Intl I18nBreakIterator SetUTF8Text performance on a long text
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0029, TestSize.Level1)
+{
+    string text;
+    while (text.length() < 102400) { // 102400 bytes of text
+        text += "The quick brown fox jumps over the lazy dog. \xe6\x95\x8f\xe6\x8d\xb7\xe7\x9a\x84\xe7\x8b\x90\xe7\x8b\xb8\xe3\x80\x82 ";
+    }
+    I18nBreakIterator iterator("en-US");
+    uint64_t total = 0;
+    for (int k = 0; k < 100; ++k) {
+        auto t1 = std::chrono::high_resolution_clock::now();
+        iterator.SetUTF8Text(text.c_str(), static_cast<int32_t>(text.length()));
+        iterator.first();
+        iterator.next();
+        auto t2 = std::chrono::high_resolution_clock::now();
+        total += std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+    }
+    EXPECT_EQ(iterator.current(), 4);
+    double average = total / 100.0;
+    EXPECT_LT(average, 100);
+}
+
+/**
+ * @tc.name: IntlFuncTest0030
+ * @tc.desc: Test Intl I18nBreakStream against I18nBreakIterator and resuming from a saved position
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0030, TestSize.Level1)
+{
+    string text;
+    for (int i = 0; i < 50; ++i) { // 50 copies of the paragraph
+        text += "The quick brown fox jumps over the lazy dog. \xe6\x95\x8f\xe6\x8d\xb7\xe7\x9a\x84\xe7\x8b\x90"
+            "\xe7\x8b\xb8\xe3\x80\x82 \xd8\xb3\xd9\x84\xd8\xa7\xd9\x85 \xe0\xb8\xaa\xe0\xb8\xa7\xe0\xb8\xb1"
+            "\xe0\xb8\xaa\xe0\xb8\x94\xe0\xb8\xb5\xe0\xb8\x84\xe0\xb8\xa3\xe0\xb8\xb1\xe0\xb8\x9a ";
+    }
+    I18nBreakIterator iterator("en-US");
+    iterator.SetUTF8Text(text.c_str(), static_cast<int32_t>(text.length()));
+    vector<int32_t> expects;
+    iterator.GetAllBoundaries(expects);
+    expects.erase(expects.begin());
+
+    I18nBreakStream stream("en-US");
+    vector<int32_t> boundaries;
+    int64_t offset = 0;
+    const size_t chunk = 7; // 7 bytes per chunk, splitting multi-byte characters
+    for (size_t pos = 0; pos < text.length(); pos += chunk) {
+        stream.Append(text.data() + pos, std::min(chunk, text.length() - pos));
+        while (stream.NextBoundary(offset)) {
+            boundaries.push_back(static_cast<int32_t>(offset));
+        }
+    }
+    stream.Finish();
+    while (stream.NextBoundary(offset)) {
+        boundaries.push_back(static_cast<int32_t>(offset));
+    }
+    EXPECT_EQ(boundaries, expects);
+
+    size_t saved = expects.size() / 2; // resume from the middle of the text
+    stream.Reset(expects[saved - 1]);
+    stream.Append(text.data() + expects[saved - 1], text.length() - expects[saved - 1]);
+    stream.Finish();
+    ASSERT_TRUE(stream.NextBoundary(offset));
+    EXPECT_EQ(offset, expects[saved]);
+    EXPECT_EQ(stream.GetPosition(), expects[saved]);
+}
+
+/**
+ * @tc.name: IntlFuncTest0031
+ * @tc.desc: Test Intl I18nBreakStream latency of the first boundaries of a long text
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0031, TestSize.Level1)
+{
+    string chunk;
+    while (chunk.length() < 4096) { // 4096 bytes per chunk
+        chunk += "The quick brown fox jumps over the lazy dog. \xe6\x95\x8f\xe6\x8d\xb7\xe7\x9a\x84\xe7\x8b\x90 ";
+    }
+    I18nBreakStream stream("en-US");
+    int64_t offset = 0;
+    int32_t count = 0;
+    auto t1 = std::chrono::high_resolution_clock::now();
+    stream.Append(chunk.data(), chunk.length());
+    while (count < 100 && stream.NextBoundary(offset)) { // 100 boundaries fill the first screen
+        ++count;
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(count, 100);
+    EXPECT_LT(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count(), 1000);
+
+    uint64_t total = 0;
+    for (int i = 0; i < 1000; ++i) { // 1000 chunks, about 4MB of text
+        t1 = std::chrono::high_resolution_clock::now();
+        stream.Append(chunk.data(), chunk.length());
+        while (stream.NextBoundary(offset)) {
+        }
+        t2 = std::chrono::high_resolution_clock::now();
+        total += std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+    }
+    EXPECT_GT(offset, 4096000);
+    double average = total / 1000.0;
+    EXPECT_LT(average, 1000);
+}
+
+/**
+ * @tc.name: IntlFuncTest0032
+ * @tc.desc: Test Intl IndexUtil GetIndex and GetIndexList
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0032, TestSize.Level1)
+{
+    IndexUtil util("en-US");
+    vector<string> indexList = util.GetIndexList();
+    ASSERT_EQ(indexList.size(), 28U); // 26 letters with the underflow and overflow buckets
+    EXPECT_EQ(indexList[1], "A");
+    EXPECT_EQ(indexList[26], "Z"); // 26 is the index of Z
+    EXPECT_EQ(util.GetIndex("Apple"), "A");
+    EXPECT_EQ(util.GetIndex("zebra"), "Z");
+    EXPECT_EQ(util.GetIndex("\xd0\x96\xd1\x83\xd0\xba"), indexList[27]); // 27 is the index of the overflow bucket
+    util.AddLocale("ru");
+    EXPECT_EQ(util.GetIndex("\xd0\x96\xd1\x83\xd0\xba"), "\xd0\x96");
+    EXPECT_EQ(util.GetIndex("zebra"), "Z");
+    EXPECT_GT(util.GetIndexList().size(), indexList.size());
+}
+
+/**
+ * @tc.name: IntlFuncTest0033
+ * @tc.desc: Test Intl IndexUtil GetIndex performance on a 100000 contact list
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0033, TestSize.Level1)
+{
+    vector<string> syllables = { "zha", "ma", "li", "wang", "chen", "yu", "xiao", "ting", "bo", "an", "\xe5\xbc\xa0",
+        "\xe7\x8e\x8b", "\xe6\x9d\x8e" };
+    vector<string> contacts;
+    const size_t contactCount = 100000;
+    contacts.reserve(contactCount);
+    for (size_t i = 0; i < contactCount; ++i) {
+        contacts.push_back(syllables[i % syllables.size()] + syllables[(i / syllables.size()) % syllables.size()] +
+            std::to_string(i));
+    }
+    IndexUtil util("zh-CN");
+    size_t labelLength = 0;
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (const string &contact : contacts) {
+        labelLength += util.GetIndex(contact).length();
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    EXPECT_GE(labelLength, contactCount);
+    EXPECT_EQ(util.GetIndex("wang"), "W");
+    double average = std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count() / (double)contactCount;
+    EXPECT_LT(average, 5000);
+}
+
+/**
+ * @tc.name: IntlFuncTest0034
+ * @tc.desc: Test Intl IndexUtil AssignBuckets and GroupByBucket
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0034, TestSize.Level1)
+{
+    IndexUtil util("en-US");
+    vector<string> names = { "zoe", "Adam", "bob", "alice", "\xd0\x96\xd1\x83\xd0\xba", "Zack", "1st" };
+    vector<int32_t> buckets;
+    ASSERT_TRUE(util.AssignBuckets(names, buckets));
+    ASSERT_EQ(buckets.size(), names.size());
+    vector<string> indexList = util.GetIndexList();
+    for (size_t i = 0; i < names.size(); ++i) {
+        ASSERT_GE(buckets[i], 0);
+        EXPECT_EQ(indexList[buckets[i]], util.GetIndex(names[i]));
+    }
+    vector<vector<int32_t>> groups;
+    ASSERT_TRUE(util.GroupByBucket(names, groups));
+    ASSERT_EQ(groups.size(), indexList.size());
+    vector<int32_t> expects = { 1, 3 }; // Adam, alice
+    EXPECT_EQ(groups[1], expects);
+    expects = { 5, 0 }; // Zack, zoe
+    EXPECT_EQ(groups[26], expects); // 26 is the index of Z
+
+    util.AddLocale("ru");
+    ASSERT_TRUE(util.AssignBuckets(names, buckets));
+    EXPECT_EQ(util.GetIndexList()[buckets[4]], "\xd0\x96"); // 4 is the index of the Cyrillic name
+}
+
+/**
+ * @tc.name: IntlFuncTest0035
+ * @tc.desc: Test Intl IndexUtil AssignBuckets performance on a 20000 contact list
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0035, TestSize.Level1)
+{
+    vector<string> syllables = { "zha", "ma", "li", "wang", "chen", "yu", "xiao", "ting", "bo", "an", "\xe5\xbc\xa0",
+        "\xe7\x8e\x8b", "\xe6\x9d\x8e" };
+    vector<string> contacts;
+    const size_t contactCount = 20000;
+    for (size_t i = 0; i < contactCount; ++i) {
+        contacts.push_back(syllables[i % syllables.size()] + syllables[(i / syllables.size()) % syllables.size()] +
+            std::to_string(i));
+    }
+    IndexUtil util("zh-CN");
+    vector<string> indexList = util.GetIndexList();
+    vector<int32_t> buckets;
+    auto t1 = std::chrono::high_resolution_clock::now();
+    ASSERT_TRUE(util.AssignBuckets(contacts, buckets));
+    auto t2 = std::chrono::high_resolution_clock::now();
+    ASSERT_EQ(buckets.size(), contactCount);
+    for (size_t i = 0; i < contactCount; i += 97) { // check every 97th contact against GetIndex
+        EXPECT_EQ(indexList[buckets[i]], util.GetIndex(contacts[i]));
+    }
+    EXPECT_LT(std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count(), 100);
+}
+
+/**
+ * @tc.name: IntlFuncTest0036
+ * @tc.desc: Test Intl I18nTimeZone GetOffset and GetOffsets around daylight saving time transitions
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0036, TestSize.Level1)
+{
+    I18nTimeZone timezone("America/New_York");
+    const int32_t hour = 3600 * 1000;
+    const double transition = 1647154800000; // 2022-03-13 07:00 UTC, daylight saving time starts in New York
+    vector<double> dates = { transition - 1, transition, transition + 1, 0, transition - 1, -1e13, 1e13 };
+    vector<int32_t> expects = { -5 * hour, -4 * hour, -4 * hour, -5 * hour, -5 * hour };
+    for (size_t i = expects.size(); i < dates.size(); ++i) {
+        expects.push_back(timezone.GetOffset(dates[i]));
+    }
+    vector<int32_t> offsets(dates.size());
+    timezone.GetOffsets(dates.data(), offsets.data(), dates.size());
+    EXPECT_EQ(offsets, expects);
+    for (int i = 0; i < 20; ++i) { // 20 calls switch GetOffset to the transition table
+        EXPECT_EQ(timezone.GetOffset(dates[i % dates.size()]), expects[i % dates.size()]);
+    }
+    EXPECT_FALSE(timezone.SetTransitionWindow(2030, 2020)); // 2030 and 2020 are an empty window
+    EXPECT_TRUE(timezone.SetTransitionWindow(2021, 2023)); // 2021 to 2023 includes the transition
+    timezone.GetOffsets(dates.data(), offsets.data(), dates.size());
+    EXPECT_EQ(offsets, expects);
+}
+
+/**
+ * @tc.name: IntlFuncTest0037
+ * @tc.desc: Test Intl I18nTimeZone GetOffsets performance on sorted dates
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0037, TestSize.Level1)
+{
+    I18nTimeZone timezone("Europe/Berlin");
+    const size_t count = 100000;
+    vector<double> dates(count);
+    for (size_t i = 0; i < count; ++i) {
+        dates[i] = 1600000000000 + i * 600000.0; // one date every 600000 milliseconds
+    }
+    vector<int32_t> offsets(count);
+    auto t1 = std::chrono::high_resolution_clock::now();
+    timezone.GetOffsets(dates.data(), offsets.data(), count);
+    auto t2 = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(offsets[0], 7200000); // 2020-09-13 is summer time in Berlin, 2 hours ahead of UTC
+    EXPECT_EQ(offsets[count - 1], timezone.GetOffset(dates[count - 1]));
+    double average = std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count() / (double)count;
+    EXPECT_LT(average, 200);
+}
+
+/**
+ * @tc.name: IntlFuncTest0038
+ * @tc.desc: Test Intl I18nTimeZone shared zones and GetDisplayNames
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0038, TestSize.Level1)
+{
+    I18nTimeZone first("Asia/Shanghai");
+    I18nTimeZone second("Asia/Shanghai");
+    EXPECT_EQ(first.GetID(), "Asia/Shanghai");
+    EXPECT_EQ(first.GetOffset(0), second.GetOffset(0));
+    string name = first.GetDisplayName("en-US", false);
+    EXPECT_FALSE(name.empty());
+    EXPECT_EQ(second.GetDisplayName("en-US", false), name);
+    vector<pair<string, string>> names;
+    ASSERT_TRUE(I18nTimeZone::GetDisplayNames("en-US", false, names));
+    EXPECT_GT(names.size(), 400U);
+    auto found = std::find_if(names.begin(), names.end(),
+        [](const pair<string, string> &item) { return item.first == "Asia/Shanghai"; });
+    ASSERT_TRUE(found != names.end());
+    EXPECT_EQ(found->second, name);
+}
+
+/**
+ * @tc.name: IntlFuncTest0039
+ * @tc.desc: Test Intl I18nTimeZone GetDisplayNames performance
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0039, TestSize.Level1)
+{
+    vector<pair<string, string>> names;
+    I18nTimeZone::GetDisplayNames("zh-Hans", false, names);
+    uint64_t total = 0;
+    for (int k = 0; k < 10; ++k) {
+        auto t1 = std::chrono::high_resolution_clock::now();
+        I18nTimeZone::GetDisplayNames("zh-Hans", false, names);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        total += std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+    }
+    EXPECT_GT(names.size(), 400U);
+    double average = total / 10.0;
+    EXPECT_LT(average, 5000);
+}
+
+/**
+ * @tc.name: IntlFuncTest0040
+ * @tc.desc: Test Intl I18nTimeZone GetTimeZoneItems
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0040, TestSize.Level1)
+{
+    const double summer = 1656676800000; // 2022-07-01 12:00 UTC
+    vector<TimeZoneItem> items;
+    ASSERT_TRUE(I18nTimeZone::GetTimeZoneItems("en-US", summer, items));
+    EXPECT_GT(items.size(), 400U);
+    for (size_t i = 1; i < items.size(); ++i) {
+        EXPECT_LE(items[i - 1].offset, items[i].offset);
+    }
+    auto found = std::find_if(items.begin(), items.end(),
+        [](const TimeZoneItem &item) { return item.zoneID == "America/New_York"; });
+    ASSERT_TRUE(found != items.end());
+    EXPECT_EQ(found->country, "US");
+    EXPECT_EQ(found->offset, -4 * 3600 * 1000); // New York is 4 hours behind UTC in summer
+    EXPECT_EQ(found->city, "New York");
+    I18nTimeZone timezone("America/New_York");
+    EXPECT_EQ(found->displayName, timezone.GetDisplayName("en-US", false));
+}
+
+/**
+ * @tc.name: IntlFuncTest0041
+ * @tc.desc: Test Intl I18nTimeZone GetTimeZoneItems performance
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0041, TestSize.Level1)
+{
+    vector<TimeZoneItem> items;
+    const double date = 1656676800000; // 2022-07-01 12:00 UTC
+    I18nTimeZone::GetTimeZoneItems("en-US", date, items);
+    uint64_t total = 0;
+    for (int k = 0; k < 10; ++k) {
+        auto t1 = std::chrono::high_resolution_clock::now();
+        I18nTimeZone::GetTimeZoneItems("en-US", date, items);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        total += std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+    }
+    EXPECT_GT(items.size(), 400U);
+    double average = total / 10.0;
+    EXPECT_LT(average, 2000);
+}
+
+/**
+ * @tc.name: IntlFuncTest0042
+ * @tc.desc: Test Intl I18nCalendar GetFields and GetMonthGrid
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0042, TestSize.Level1)
+{
+    I18nCalendar calendar("en-US", GREGORY);
+    calendar.SetTimeZone("America/New_York");
+    calendar.SetFirstDayOfWeek(UCAL_SUNDAY);
+    const double now = 1656676800000; // 2022-07-01 12:00 UTC
+    const double other = 1672531200000; // 2023-01-01 00:00 UTC
+    calendar.SetTime(now);
+    const UCalendarDateFields fields[] = { UCAL_YEAR, UCAL_MONTH, UCAL_DATE, UCAL_DAY_OF_WEEK, UCAL_WEEK_OF_YEAR };
+    const size_t count = sizeof(fields) / sizeof(fields[0]);
+    int32_t values[count] = { 0 };
+    ASSERT_TRUE(calendar.GetFields(now, fields, values, count));
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(values[i], calendar.Get(fields[i]));
+    }
+    ASSERT_TRUE(calendar.GetFields(other, fields, values, count));
+    EXPECT_EQ(values[0], 2022); // 2023-01-01 00:00 UTC is still 2022 in New York
+    EXPECT_EQ(calendar.Get(UCAL_DATE), 1);
+    vector<int32_t> cells;
+    ASSERT_TRUE(calendar.GetMonthGrid(2022, UCAL_JULY, fields, count, cells));
+    ASSERT_EQ(cells.size(), I18nCalendar::MONTH_GRID_CELLS * count);
+    const int32_t first[] = { 2022, UCAL_JUNE, 26, UCAL_SUNDAY, 27 };
+    const int32_t firstOfMonth[] = { 2022, UCAL_JULY, 1, UCAL_FRIDAY, 27 };
+    const int32_t last[] = { 2022, UCAL_AUGUST, 6, UCAL_SATURDAY, 32 };
+    // 5 is the cell of July 1st, 41 is the last cell
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(cells[i], first[i]);
+        EXPECT_EQ(cells[5 * count + i], firstOfMonth[i]);
+        EXPECT_EQ(cells[41 * count + i], last[i]);
+    }
+    EXPECT_EQ(calendar.Get(UCAL_MONTH), UCAL_JULY);
+    calendar.SetFirstDayOfWeek(UCAL_MONDAY);
+    ASSERT_TRUE(calendar.GetMonthGrid(2022, UCAL_JULY, fields, count, cells));
+    EXPECT_EQ(cells[2], 27); // 2 is the date field of the first cell
+}
+
+/**
+ * @tc.name: IntlFuncTest0043
+ * @tc.desc: Test Intl I18nCalendar GetMonthGrid performance
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0043, TestSize.Level1)
+{
+    I18nCalendar calendar("zh-Hans", CHINESE);
+    const UCalendarDateFields fields[] = { UCAL_YEAR, UCAL_MONTH, UCAL_DATE, UCAL_DAY_OF_WEEK, UCAL_WEEK_OF_YEAR };
+    const size_t count = sizeof(fields) / sizeof(fields[0]);
+    vector<int32_t> cells;
+    uint64_t total = 0;
+    for (int k = 0; k < 12; ++k) {
+        auto t1 = std::chrono::high_resolution_clock::now();
+        calendar.GetMonthGrid(40, k, fields, count, cells); // 40 is a year of the current chinese calendar cycle
+        auto t2 = std::chrono::high_resolution_clock::now();
+        total += std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+    }
+    EXPECT_EQ(cells.size(), I18nCalendar::MONTH_GRID_CELLS * count);
+    double average = total / 12.0;
+    EXPECT_LT(average, 5000);
+}
+
+/**
+ * @tc.name: IntlFuncTest0044
+ * @tc.desc: Test Intl I18nCalendar GetWeekendBitmap
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0044, TestSize.Level1)
+{
+    const int64_t start = 1577856600000; // 2020-01-01 00:30 in New York
+    const int64_t oneDay = 86400000;
+    const int32_t days = 3653;
+    const vector<string> locales = { "en-US", "he-IL", "fa-IR" };
+    for (const string &locale : locales) {
+        I18nCalendar calendar(locale);
+        calendar.SetTimeZone("America/New_York");
+        UErrorCode status = U_ZERO_ERROR;
+        std::unique_ptr<icu::Calendar> expected(icu::Calendar::createInstance(
+            icu::TimeZone::createTimeZone("America/New_York"), icu::Locale::forLanguageTag(locale, status), status));
+        ASSERT_TRUE(U_SUCCESS(status));
+        vector<uint8_t> bitmap;
+        ASSERT_TRUE(calendar.GetWeekendBitmap(start, days, bitmap));
+        ASSERT_EQ(bitmap.size(), (days + 7) / 8U);
+        int32_t weekends = 0;
+        for (int32_t i = 0; i < days; ++i) {
+            int64_t date = start + i * oneDay;
+            bool isWeekend = (bitmap[i / 8] >> (i % 8)) & 1;
+            EXPECT_EQ(isWeekend, static_cast<bool>(expected->isWeekend(date, status)));
+            EXPECT_EQ(isWeekend, calendar.IsWeekend(date, status));
+            weekends += isWeekend ? 1 : 0;
+        }
+        EXPECT_GT(weekends, days / 8);
+    }
+    vector<uint8_t> bitmap;
+    I18nCalendar calendar("en-US");
+    EXPECT_FALSE(calendar.GetWeekendBitmap(start, -1, bitmap));
+    EXPECT_TRUE(calendar.GetWeekendBitmap(start, 0, bitmap));
+    EXPECT_TRUE(bitmap.empty());
+}
+
+/**
+ * @tc.name: IntlFuncTest0045
+ * @tc.desc: Test Intl I18nCalendar GetWeekendBitmap performance over ten years
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0045, TestSize.Level1)
+{
+    I18nCalendar calendar("en-US");
+    calendar.SetTimeZone("Europe/London");
+    const int64_t start = 1577836800000; // 2020-01-01 00:00 UTC
+    const int32_t days = 3653;
+    vector<uint8_t> bitmap;
+    uint64_t total = 0;
+    for (int k = 0; k < 10; ++k) {
+        auto t1 = std::chrono::high_resolution_clock::now();
+        calendar.GetWeekendBitmap(start, days, bitmap);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        total += std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+    }
+    EXPECT_EQ(bitmap.size(), (days + 7) / 8U);
+    double average = total / 10.0;
+    EXPECT_LT(average, 1000);
+}
+
+/**
+ * @tc.name: IntlFuncTest0046
+ * @tc.desc: Test Intl I18nCalendar Preload
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0046, TestSize.Level1)
+{
+    EXPECT_TRUE(I18nCalendar::Preload("zh-Hans-u-ca-chinese", UNDEFINED));
+    EXPECT_TRUE(I18nCalendar::Preload("ar-SA", ISLAMIC_UMALQURA));
+    const double date = 1656676800000; // 2022-07-01 12:00 UTC
+    UErrorCode status = U_ZERO_ERROR;
+    std::unique_ptr<icu::Calendar> expected(icu::Calendar::createInstance(
+        icu::Locale::forLanguageTag("zh-Hans-u-ca-chinese", status), status));
+    ASSERT_TRUE(U_SUCCESS(status));
+    I18nCalendar first("zh-Hans-u-ca-chinese");
+    I18nCalendar second("zh-Hans-u-ca-chinese");
+    int32_t year = expected->get(UCAL_EXTENDED_YEAR, status);
+    EXPECT_EQ(first.Get(UCAL_EXTENDED_YEAR), year);
+    EXPECT_EQ(first.Get(UCAL_DAY_OF_YEAR), expected->get(UCAL_DAY_OF_YEAR, status));
+    EXPECT_EQ(first.GetTimeZone(), second.GetTimeZone());
+    first.SetTime(date);
+    first.SetTimeZone("Asia/Shanghai");
+    expected->setTimeZone(*std::unique_ptr<icu::TimeZone>(icu::TimeZone::createTimeZone("Asia/Shanghai")));
+    expected->setTime(date, status);
+    EXPECT_EQ(first.Get(UCAL_MONTH), expected->get(UCAL_MONTH, status));
+    EXPECT_EQ(first.Get(UCAL_DATE), expected->get(UCAL_DATE, status));
+    EXPECT_EQ(first.Get(UCAL_IS_LEAP_MONTH), expected->get(UCAL_IS_LEAP_MONTH, status));
+    EXPECT_EQ(second.Get(UCAL_EXTENDED_YEAR), year);
+}
+
+/**
+ * @tc.name: IntlFuncTest0047
+ * @tc.desc: Test Intl I18nCalendar construction performance with cached prototypes
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0047, TestSize.Level1)
+{
+    I18nCalendar::Preload("ar-SA", ISLAMIC_UMALQURA);
+    uint64_t total = 0;
+    for (int k = 0; k < 100; ++k) {
+        auto t1 = std::chrono::high_resolution_clock::now();
+        I18nCalendar calendar("ar-SA", ISLAMIC_UMALQURA);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        total += std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+    }
+    double average = total / 100.0;
+    EXPECT_LT(average, 100);
+}
+
+/**
+ * @tc.name: IntlFuncTest0048
+ * @tc.desc: Test Intl I18nCalendar GetFields of lunar calendars against icu for every day from 1900 to 2100
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0048, TestSize.Level1)
+{
+    const vector<string> tags = { "zh-Hans-u-ca-chinese", "he-IL-u-ca-hebrew", "ar-SA-u-ca-islamic-civil",
+        "ar-SA-u-ca-islamic-tbla", "ar-SA-u-ca-islamic-umalqura" };
+    const UCalendarDateFields fields[] = { UCAL_ERA, UCAL_YEAR, UCAL_EXTENDED_YEAR, UCAL_MONTH, UCAL_IS_LEAP_MONTH,
+        UCAL_DATE, UCAL_DAY_OF_YEAR, UCAL_DAY_OF_WEEK, UCAL_JULIAN_DAY };
+    const size_t count = sizeof(fields) / sizeof(fields[0]);
+    const int64_t oneDay = 86400000;
+    const int64_t firstDay = -25567; // 1900-01-01
+    const int64_t lastDay = 47846; // 2100-12-31
+    const int64_t noon = 4 * 3600 * 1000; // 12:00 in Shanghai
+    for (const string &tag : tags) {
+        EXPECT_TRUE(I18nCalendar::Preload(tag, UNDEFINED));
+        I18nCalendar calendar(tag);
+        calendar.SetTimeZone("Asia/Shanghai");
+        UErrorCode status = U_ZERO_ERROR;
+        std::unique_ptr<icu::Calendar> expected(icu::Calendar::createInstance(
+            icu::TimeZone::createTimeZone("Asia/Shanghai"), icu::Locale::forLanguageTag(tag, status), status));
+        ASSERT_TRUE(U_SUCCESS(status));
+        int32_t values[count] = { 0 };
+        int32_t mismatches = 0;
+        for (int64_t day = firstDay; day <= lastDay; ++day) {
+            double time = day * oneDay + noon;
+            ASSERT_TRUE(calendar.GetFields(time, fields, values, count));
+            expected->setTime(time, status);
+            for (size_t i = 0; i < count; ++i) {
+                mismatches += (values[i] == expected->get(fields[i], status)) ? 0 : 1;
+            }
+        }
+        EXPECT_EQ(mismatches, 0);
+        const double before = -3786825600000; // 1850-01-01 00:00 UTC, outside of the month table
+        ASSERT_TRUE(calendar.GetFields(before, fields, values, count));
+        expected->setTime(before, status);
+        EXPECT_EQ(values[3], expected->get(UCAL_MONTH, status)); // 3 is the month field
+        EXPECT_EQ(values[5], expected->get(UCAL_DATE, status)); // 5 is the date field
+    }
+}
+
+/**
+ * @tc.name: IntlFuncTest0049
+ * @tc.desc: Test Intl I18nCalendar per day conversion performance of the chinese calendar
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0049, TestSize.Level1)
+{
+    I18nCalendar::Preload("zh-Hans-u-ca-chinese", UNDEFINED);
+    I18nCalendar calendar("zh-Hans-u-ca-chinese");
+    const UCalendarDateFields fields[] = { UCAL_YEAR, UCAL_MONTH, UCAL_IS_LEAP_MONTH, UCAL_DATE, UCAL_DAY_OF_WEEK };
+    const size_t count = sizeof(fields) / sizeof(fields[0]);
+    int32_t values[count] = { 0 };
+    const double start = 1640995200000; // 2022-01-01 00:00 UTC
+    const int64_t oneDay = 86400000;
+    const int32_t days = 365;
+    calendar.GetFields(start, fields, values, count);
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (int32_t i = 0; i < days; ++i) {
+        calendar.GetFields(start + i * oneDay, fields, values, count);
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    uint64_t total = std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count();
+    double average = static_cast<double>(total) / days;
+    EXPECT_LT(average, 2000);
+}
+
+/**
+ * @tc.name: IntlFuncTest0050
+ * @tc.desc: Test Intl I18nBreakStream forced breaks in a long text without break opportunities
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0050, TestSize.Level1)
+{
+    string text;
+    while (text.length() < 3 * I18nBreakStream::MAX_BUFFERED) {
+        text += "\xd0\x96a\xf0\x9d\x90\x80"; // letters of 2, 1 and 4 bytes
+    }
+    I18nBreakStream stream("en-US");
+    const size_t chunkSize = 4099; // chunks end in the middle of characters
+    vector<int64_t> offsets;
+    int64_t offset = 0;
+    for (size_t start = 0; start < text.length(); start += chunkSize) {
+        stream.Append(text.data() + start, std::min(chunkSize, text.length() - start));
+        while (stream.NextBoundary(offset)) {
+            offsets.push_back(offset);
+        }
+    }
+    EXPECT_FALSE(offsets.empty());
+    stream.Finish();
+    while (stream.NextBoundary(offset)) {
+        offsets.push_back(offset);
+    }
+    ASSERT_FALSE(offsets.empty());
+    EXPECT_EQ(offsets.back(), static_cast<int64_t>(text.length()));
+    for (int64_t boundary : offsets) {
+        ASSERT_LE(boundary, static_cast<int64_t>(text.length()));
+        if (boundary < static_cast<int64_t>(text.length())) {
+            EXPECT_FALSE(U8_IS_TRAIL(text[boundary]));
+        }
+    }
+}
 }
@@ -35,4 +35,35 @@ int IntlFuncTest0016();
 int IntlFuncTest0017();
 int IntlFuncTest0018();
 int IntlFuncTest0019();
+int IntlFuncTest0020();
+int IntlFuncTest0021();
+int IntlFuncTest0022();
+int IntlFuncTest0023();
+int IntlFuncTest0024();
+int IntlFuncTest0025();
+int IntlFuncTest0026();
+int IntlFuncTest0027();
+int IntlFuncTest0028();
+int IntlFuncTest0029();
+int IntlFuncTest0030();
+int IntlFuncTest0031();
+int IntlFuncTest0032();
+int IntlFuncTest0033();
+int IntlFuncTest0034();
+int IntlFuncTest0035();
+int IntlFuncTest0036();
+int IntlFuncTest0037();
+int IntlFuncTest0038();
+int IntlFuncTest0039();
+int IntlFuncTest0040();
+int IntlFuncTest0041();
+int IntlFuncTest0042();
+int IntlFuncTest0043();
+int IntlFuncTest0044();
+int IntlFuncTest0045();
+int IntlFuncTest0046();
+int IntlFuncTest0047();
+int IntlFuncTest0048();
+int IntlFuncTest0049();
+int IntlFuncTest0050();
 #endif
\ No newline at end of file
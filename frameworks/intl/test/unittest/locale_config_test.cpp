@@ -14,6 +14,7 @@
  */
 
 #include "locale_config_test.h"
+#include <chrono>
 #include <gtest/gtest.h>
 #include "locale_config.h"
 #include "parameter.h"
@@ -185,4 +186,81 @@ HWTEST_F(LocaleConfigTest, LocaleConfigFuncTest012, TestSize.Level1)
 {
     EXPECT_EQ(LocaleConfig::GetDisplayRegion("zh-Hans", "en-US", true), "China");
 }
+
+/**
+ * @tc.name: LocaleConfigFuncTest013
+ * @tc.desc: Test LocaleConfig IsSuggested with region
+ * @tc.type: FUNC
+ */
+HWTEST_F(LocaleConfigTest, LocaleConfigFuncTest013, TestSize.Level1)
+{
+    EXPECT_TRUE(LocaleConfig::IsSuggested("zh-Hans", "CN"));
+    EXPECT_TRUE(LocaleConfig::IsSuggested("zh", "CN"));
+    EXPECT_FALSE(LocaleConfig::IsSuggested("zh-Hans", "US"));
+    EXPECT_FALSE(LocaleConfig::IsSuggested("zh-Hans", "XX"));
+}
+
+/**
+ * @tc.name: LocaleConfigFuncTest014
+ * @tc.desc: Test LocaleConfig IsSuggested performance when populating the language picker
+ * @tc.type: FUNC
+ */
+HWTEST_F(LocaleConfigTest, LocaleConfigFuncTest014, TestSize.Level1)
+{
+    vector<string> languages;
+    LocaleConfig::GetSystemLanguages(languages);
+    languages.push_back("fr");
+    languages.push_back("es-419");
+    uint64_t total = 0;
+    for (int k = 0; k < 100; ++k) {
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (const string &language : languages) {
+            LocaleConfig::IsSuggested(language, "CN");
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+        total += std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+    }
+    double average = total / (100.0 * languages.size());
+    EXPECT_LT(average, 10);
+}
+
+/**
+ * @tc.name: LocaleConfigFuncTest015
+ * @tc.desc: Test LocaleConfig GetDisplayLanguages and GetDisplayRegions
+ * @tc.type: FUNC
+ */
+HWTEST_F(LocaleConfigTest, LocaleConfigFuncTest015, TestSize.Level1)
+{
+    vector<string> languages = { "fr", "zh-Hant-TW", "es-Latn-US" };
+    vector<string> names = LocaleConfig::GetDisplayLanguages(languages, "en-US", true);
+    ASSERT_EQ(names.size(), languages.size());
+    for (size_t i = 0; i < languages.size(); ++i) {
+        EXPECT_EQ(names[i], LocaleConfig::GetDisplayLanguage(languages[i], "en-US", true));
+    }
+    vector<string> regions = { "CN", "zh-Hans" };
+    names = LocaleConfig::GetDisplayRegions(regions, "en-US", true);
+    ASSERT_EQ(names.size(), regions.size());
+    EXPECT_EQ(names[0], "China");
+    EXPECT_EQ(names[1], "China");
+}
+
+/**
+ * @tc.name: LocaleConfigFuncTest016
+ * @tc.desc: Test LocaleConfig GetSortedDisplayLanguages and GetSortedDisplayRegions
+ * @tc.type: FUNC
+ */
+HWTEST_F(LocaleConfigTest, LocaleConfigFuncTest016, TestSize.Level1)
+{
+    vector<pair<string, string>> sorted;
+    LocaleConfig::GetSortedDisplayLanguages({ "fr", "de", "en" }, "en-US", true, sorted);
+    ASSERT_EQ(sorted.size(), 3U);
+    EXPECT_EQ(sorted[0].first, "en");
+    EXPECT_EQ(sorted[1].first, "fr");
+    EXPECT_EQ(sorted[2].first, "de");
+    LocaleConfig::GetSortedDisplayRegions({ "JP", "DE", "AT" }, "en-US", false, sorted);
+    ASSERT_EQ(sorted.size(), 3U);
+    EXPECT_EQ(sorted[0].second, "Austria");
+    EXPECT_EQ(sorted[1].second, "Germany");
+    EXPECT_EQ(sorted[2].second, "Japan");
+}
 } // namespace
\ No newline at end of file
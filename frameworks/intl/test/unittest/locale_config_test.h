@@ -28,4 +28,8 @@ int LocaleConfigFuncTest009(void);
 int LocaleConfigFuncTest010(void);
 int LocaleConfigFuncTest011(void);
 int LocaleConfigFuncTest012(void);
+int LocaleConfigFuncTest013(void);
+int LocaleConfigFuncTest014(void);
+int LocaleConfigFuncTest015(void);
+int LocaleConfigFuncTest016(void);
 #endif
\ No newline at end of file
@@ -16,9 +16,14 @@
 #include "zone_util.h"
 #include <algorithm>
 #include <cctype>
+#include <memory>
+#include <set>
 #include "ohos/init_data.h"
 #include "strenum.h"
+#include "unicode/basictz.h"
+#include "unicode/calendar.h"
 #include "unicode/timezone.h"
+#include "unicode/tztrans.h"
 
 using namespace OHOS::Global::I18n;
 using namespace icu;
@@ -60,153 +65,336 @@ unordered_map<string, string> ZoneUtil::defaultMap = {
 };
 
 bool ZoneUtil::icuInitialized = ZoneUtil::Init();
+unordered_map<string, vector<ZoneUtil::ZoneInfo>> ZoneUtil::countryZones;
+once_flag ZoneUtil::countryZonesFlag;
+unordered_map<uint64_t, vector<ZoneUtil::ZonePeriod>> ZoneUtil::offsetPeriods;
+once_flag ZoneUtil::offsetPeriodsFlag;
+double ZoneUtil::periodsStart = 0;
+double ZoneUtil::periodsEnd = 0;
+vector<string> ZoneUtil::countryDefaults;
+vector<int16_t> ZoneUtil::callingCodeCountries;
+once_flag ZoneUtil::callingCodesFlag;
+// Offset periods are precomputed from one year before the index is built to five years after it.
+static constexpr double PERIODS_BEFORE = 365.0 * U_MILLIS_PER_DAY;
+static constexpr double PERIODS_AFTER = 5 * 365.0 * U_MILLIS_PER_DAY;
+static constexpr char NON_GEO_REGION[] = "001";
 
 string ZoneUtil::GetDefaultZone(const string &country)
 {
-    string temp(country);
-    for (size_t i = 0; i < temp.size(); i++) {
-        temp[i] = (char)toupper(temp[i]);
+    int32_t countryIndex = GetCountryIndex(country);
+    if (countryIndex >= 0) {
+        call_once(countryZonesFlag, BuildZoneIndex);
+        return countryDefaults[countryIndex];
     }
-    if (defaultMap.find(temp) != defaultMap.end()) {
-        return defaultMap[temp];
-    }
-    string ret;
-    StringEnumeration *strEnum = TimeZone::createEnumeration(temp.c_str());
-    GetString(strEnum, ret);
-    if (strEnum != nullptr) {
-        delete strEnum;
+    // defaultMap only holds two letter codes
+    const vector<ZoneInfo> *zones = FindZones(country);
+    if (!zones) {
+        return "";
     }
-    return ret;
+    return zones->front().id;
 }
 
 string ZoneUtil::GetDefaultZone(const int32_t number)
 {
-    string *region_code = new(nothrow) string();
-    if (!region_code) {
+    int32_t countryIndex = GetCallingCodeCountry(phone_util, number);
+    if (countryIndex < 0) {
         return "";
     }
-    phone_util.GetRegionCodeForCountryCode(number, region_code);
-    if (!region_code) {
-        return "";
+    if (countryIndex == NON_GEO_COUNTRY) {
+        return GetDefaultZone(string(NON_GEO_REGION));
     }
-    string ret = GetDefaultZone(*region_code);
-    delete region_code;
-    return ret;
+    call_once(countryZonesFlag, BuildZoneIndex);
+    return countryDefaults[countryIndex];
 }
 
 string ZoneUtil::GetDefaultZone(const string country, const int32_t offset)
 {
-    UErrorCode status = U_ZERO_ERROR;
-    StringEnumeration *strEnum =
-        TimeZone::createTimeZoneIDEnumeration(UCAL_ZONE_TYPE_ANY, country.c_str(), &offset, status);
-    if (status != U_ZERO_ERROR) {
+    const vector<ZoneInfo> *zones = FindZones(country);
+    if (!zones) {
         return "";
     }
-    string ret;
-    GetString(strEnum, ret);
-    if (strEnum != nullptr) {
-        delete strEnum;
-        strEnum = nullptr;
+    for (const ZoneInfo &zone : *zones) {
+        if (zone.rawOffset == offset) {
+            return zone.id;
+        }
     }
-    return ret;
+    return "";
 }
 
 string ZoneUtil::GetDefaultZone(const int32_t number, const int32_t offset)
 {
-    string *region_code = new(nothrow) string();
-    if (!region_code) {
+    int32_t countryIndex = GetCallingCodeCountry(phone_util, number);
+    if (countryIndex < 0) {
         return "";
     }
-    phone_util.GetRegionCodeForCountryCode(number, region_code);
-    if (!region_code) {
-        return "";
+    if (countryIndex == NON_GEO_COUNTRY) {
+        return GetDefaultZone(string(NON_GEO_REGION), offset);
     }
-    string ret = GetDefaultZone(*region_code, offset);
-    delete region_code;
-    return ret;
+    const char country[] = { (char)('A' + countryIndex / 26), (char)('A' + countryIndex % 26), '\0' };
+    return GetDefaultZone(country, offset);
 }
 
 void ZoneUtil::GetZoneList(const string country, vector<string> &retVec)
 {
-    StringEnumeration *strEnum = TimeZone::createEnumeration(country.c_str());
-    GetList(strEnum, retVec);
-    if (strEnum != nullptr) {
-        delete strEnum;
-        strEnum = nullptr;
+    const vector<ZoneInfo> *zones = FindZones(country);
+    if (!zones) {
+        return;
+    }
+    bool checkExisting = !retVec.empty();
+    for (const ZoneInfo &zone : *zones) {
+        AppendZone(zone.id, retVec, checkExisting);
     }
 }
 
 void ZoneUtil::GetZoneList(const string country, const int32_t offset, vector<string> &retVec)
 {
-    UErrorCode status = U_ZERO_ERROR;
-    StringEnumeration *strEnum =
-        TimeZone::createTimeZoneIDEnumeration(UCAL_ZONE_TYPE_ANY, country.c_str(), &offset, status);
-    if (status != U_ZERO_ERROR) {
-        delete strEnum;
-        strEnum = nullptr;
+    const vector<ZoneInfo> *zones = FindZones(country);
+    if (!zones) {
         return;
     }
-    GetList(strEnum, retVec);
-    if (strEnum != nullptr) {
-        delete strEnum;
-        strEnum = nullptr;
+    bool checkExisting = !retVec.empty();
+    for (const ZoneInfo &zone : *zones) {
+        if (zone.rawOffset == offset) {
+            AppendZone(zone.id, retVec, checkExisting);
+        }
     }
 }
 
-void ZoneUtil::GetString(StringEnumeration *strEnum, string& ret)
+string ZoneUtil::GetDefaultZone(const string &country, const int32_t offset, bool isDST, double date)
 {
-    UErrorCode status = U_ZERO_ERROR;
-    UnicodeString uniString;
-    if (!strEnum) {
-        return;
+    vector<size_t> matches;
+    const vector<ZoneInfo> *zones = FindZones(country, offset, isDST, date, matches);
+    if (!zones || matches.empty()) {
+        return "";
     }
-    int32_t count = strEnum->count(status);
-    if ((status != U_ZERO_ERROR) || count <= 0) {
-        return;
+    int32_t countryIndex = GetCountryIndex(country);
+    if (countryIndex >= 0) {
+        for (size_t match : matches) {
+            if ((*zones)[match].id == countryDefaults[countryIndex]) {
+                return countryDefaults[countryIndex];
+            }
+        }
     }
-    const UnicodeString *uniStr = strEnum->snext(status);
-    if ((status != U_ZERO_ERROR) || (!uniStr)) {
+    return (*zones)[matches.front()].id;
+}
+
+void ZoneUtil::GetZoneList(const string &country, const int32_t offset, bool isDST, double date,
+    vector<string> &retVec)
+{
+    vector<size_t> matches;
+    const vector<ZoneInfo> *zones = FindZones(country, offset, isDST, date, matches);
+    if (!zones) {
         return;
     }
-    UnicodeString canonicalUnistring;
-    TimeZone::getCanonicalID(*uniStr, canonicalUnistring, status);
-    if (status != U_ZERO_ERROR) {
-        return;
+    bool checkExisting = !retVec.empty();
+    for (size_t match : matches) {
+        AppendZone((*zones)[match].id, retVec, checkExisting);
     }
-    canonicalUnistring.toUTF8String(ret);
-    return;
 }
 
-void ZoneUtil::GetList(StringEnumeration *strEnum, vector<string> &retVec)
+void ZoneUtil::AppendZone(const string &id, vector<string> &retVec, bool checkExisting)
 {
-    if (!strEnum) {
+    if (checkExisting && (find(retVec.begin(), retVec.end(), id) != retVec.end())) {
         return;
     }
+    retVec.push_back(id);
+}
+
+// Returns the canonical zones of the country in ICU's enumeration order, or nullptr if it has none. The country
+// code is not case sensitive.
+const vector<ZoneUtil::ZoneInfo> *ZoneUtil::FindZones(const string &country)
+{
+    call_once(countryZonesFlag, BuildZoneIndex);
+    string key(country);
+    for (size_t i = 0; i < key.size(); i++) {
+        key[i] = (char)toupper(key[i]);
+    }
+    auto iter = countryZones.find(key);
+    if (iter == countryZones.end() || iter->second.empty()) {
+        return nullptr;
+    }
+    return &iter->second;
+}
+
+// Maps a two letter country code, in either case, to 0 ... COUNTRY_COUNT - 1. Returns -1 for other strings.
+int32_t ZoneUtil::GetCountryIndex(const string &country)
+{
+    // 2 is the length of a country code
+    if (country.length() != 2 || !isalpha((unsigned char)country[0]) || !isalpha((unsigned char)country[1])) {
+        return -1;
+    }
+    return (toupper(country[0]) - 'A') * 26 + (toupper(country[1]) - 'A'); // 26 letters
+}
+
+// Returns the GetCountryIndex of the main country of a calling code, NON_GEO_COUNTRY for non geographic calling
+// codes, or -1 if there is none.
+int32_t ZoneUtil::GetCallingCodeCountry(const i18n::phonenumbers::PhoneNumberUtil &phoneUtil, const int32_t number)
+{
+    call_once(callingCodesFlag, BuildCallingCodeIndex, cref(phoneUtil));
+    if (number < 0 || number >= MAX_CALLING_CODE) {
+        return -1;
+    }
+    return callingCodeCountries[number];
+}
+
+void ZoneUtil::BuildCallingCodeIndex(const i18n::phonenumbers::PhoneNumberUtil &phoneUtil)
+{
+    callingCodeCountries.assign(MAX_CALLING_CODE, -1);
+    set<int> callingCodes;
+    phoneUtil.GetSupportedCallingCodes(&callingCodes);
+    for (int callingCode : callingCodes) {
+        if (callingCode < 0 || callingCode >= MAX_CALLING_CODE) {
+            continue;
+        }
+        string region;
+        phoneUtil.GetRegionCodeForCountryCode(callingCode, &region);
+        int32_t countryIndex = GetCountryIndex(region);
+        if (countryIndex < 0 && region == NON_GEO_REGION) {
+            countryIndex = NON_GEO_COUNTRY;
+        }
+        callingCodeCountries[callingCode] = (int16_t)countryIndex;
+    }
+}
+
+// Fills matches with the indices, in the country's zone list, of the zones whose total offset and DST state at
+// date are offset and isDST, in the order of that list.
+const vector<ZoneUtil::ZoneInfo> *ZoneUtil::FindZones(const string &country, const int32_t offset, bool isDST,
+    double date, vector<size_t> &matches)
+{
+    const vector<ZoneInfo> *zones = FindZones(country);
+    if (!zones) {
+        return nullptr;
+    }
+    call_once(offsetPeriodsFlag, BuildOffsetIndex);
+    int32_t countryIndex = GetCountryIndex(country);
+    if (countryIndex >= 0 && date >= periodsStart && date < periodsEnd) {
+        auto iter = offsetPeriods.find(GetOffsetKey(countryIndex, offset, isDST));
+        if (iter == offsetPeriods.end()) {
+            return zones;
+        }
+        for (const ZonePeriod &period : iter->second) {
+            if (date >= period.start && date < period.end &&
+                (matches.empty() || matches.back() != period.zone)) {
+                matches.push_back(period.zone);
+            }
+        }
+        return zones;
+    }
+    // outside of the precomputed range the offsets are asked from ICU directly
+    for (size_t i = 0; i < zones->size(); ++i) {
+        unique_ptr<TimeZone> zone(TimeZone::createTimeZone((*zones)[i].id.c_str()));
+        UErrorCode status = U_ZERO_ERROR;
+        int32_t rawOffset = 0;
+        int32_t dstOffset = 0;
+        zone->getOffset(date, false, rawOffset, dstOffset, status);
+        if (U_SUCCESS(status) && rawOffset + dstOffset == offset && (dstOffset != 0) == isDST) {
+            matches.push_back(i);
+        }
+    }
+    return zones;
+}
+
+// Packs a GetCountryIndex, the DST state and the total offset into one integer.
+uint64_t ZoneUtil::GetOffsetKey(int32_t countryIndex, const int32_t offset, bool isDST)
+{
+    // 33 and 32 are the bit positions above the 32 bits of the offset
+    return ((uint64_t)countryIndex << 33) | ((uint64_t)(isDST ? 1 : 0) << 32) | (uint32_t)offset;
+}
+
+// Splits the precomputed range of every zone at its ICU transitions, and files the pieces under their country,
+// total offset and DST state. The periods of each key are ordered by zone, as in the country's zone list.
+void ZoneUtil::BuildOffsetIndex()
+{
+    periodsStart = Calendar::getNow() - PERIODS_BEFORE;
+    periodsEnd = Calendar::getNow() + PERIODS_AFTER;
+    for (const auto &country : countryZones) {
+        int32_t countryIndex = GetCountryIndex(country.first);
+        if (countryIndex < 0) {
+            continue;
+        }
+        for (size_t i = 0; i < country.second.size(); ++i) {
+            AddZonePeriods(country.first, countryIndex, i);
+        }
+    }
+}
+
+void ZoneUtil::AddZonePeriods(const string &country, int32_t countryIndex, size_t zone)
+{
+    unique_ptr<TimeZone> timeZone(TimeZone::createTimeZone(countryZones[country][zone].id.c_str()));
+    BasicTimeZone *basicZone = dynamic_cast<BasicTimeZone *>(timeZone.get());
     UErrorCode status = U_ZERO_ERROR;
-    int32_t count = strEnum->count(status);
-    if (count <= 0 || status != U_ZERO_ERROR) {
+    int32_t rawOffset = 0;
+    int32_t dstOffset = 0;
+    timeZone->getOffset(periodsStart, false, rawOffset, dstOffset, status);
+    if (U_FAILURE(status)) {
         return;
     }
-    while (count > 0) {
-        const UnicodeString *uniStr = strEnum->snext(status);
-        if ((!uniStr) || (status != U_ZERO_ERROR)) {
-            retVec.clear();
-            break;
+    double start = periodsStart;
+    while (start < periodsEnd) {
+        TimeZoneTransition transition;
+        double end = periodsEnd;
+        bool hasNext = (basicZone != nullptr) && basicZone->getNextTransition(start, false, transition);
+        if (hasNext && transition.getTime() < periodsEnd) {
+            end = transition.getTime();
+        }
+        vector<ZonePeriod> &periods = offsetPeriods[GetOffsetKey(countryIndex, rawOffset + dstOffset, dstOffset != 0)];
+        if (!periods.empty() && periods.back().zone == zone && periods.back().end == start) {
+            periods.back().end = end;
+        } else {
+            periods.push_back({ zone, start, end });
         }
-        UnicodeString canonicalUnistring;
-        TimeZone::getCanonicalID(*uniStr, canonicalUnistring, status);
-        if (status != U_ZERO_ERROR) {
-            retVec.clear();
+        if (end >= periodsEnd) {
             break;
         }
-        string canonicalString = "";
-        canonicalUnistring.toUTF8String(canonicalString);
-        if ((canonicalString != "") && (find(retVec.begin(), retVec.end(), canonicalString) == retVec.end())) {
-            retVec.push_back(canonicalString);
+        rawOffset = transition.getTo()->getRawOffset();
+        dstOffset = transition.getTo()->getDSTSavings();
+        start = end;
+    }
+}
+
+// Walks every ICU zone ID once and files its canonical ID under the ID's region, skipping duplicates, so that
+// each country maps to what TimeZone::createEnumeration(country) followed by getCanonicalID would return.
+void ZoneUtil::BuildZoneIndex()
+{
+    countryDefaults.assign(COUNTRY_COUNT, "");
+    UErrorCode status = U_ZERO_ERROR;
+    unique_ptr<StringEnumeration> ids(
+        TimeZone::createTimeZoneIDEnumeration(UCAL_ZONE_TYPE_ANY, nullptr, nullptr, status));
+    if (U_FAILURE(status) || !ids) {
+        return;
+    }
+    const UnicodeString *id = nullptr;
+    while ((id = ids->snext(status)) != nullptr && U_SUCCESS(status)) {
+        char region[4]; // 4 is enough for region codes such as "001"
+        TimeZone::getRegion(*id, region, sizeof(region), status);
+        UnicodeString canonical;
+        TimeZone::getCanonicalID(*id, canonical, status);
+        if (U_FAILURE(status)) {
+            status = U_ZERO_ERROR;
+            continue;
+        }
+        ZoneInfo info;
+        canonical.toUTF8String(info.id);
+        vector<ZoneInfo> &zones = countryZones[region];
+        auto sameId = [&info](const ZoneInfo &zone) { return zone.id == info.id; };
+        if (info.id.empty() || find_if(zones.begin(), zones.end(), sameId) != zones.end()) {
+            continue;
+        }
+        unique_ptr<TimeZone> zone(TimeZone::createTimeZone(*id));
+        info.rawOffset = zone->getRawOffset();
+        info.dstSavings = zone->getDSTSavings();
+        zones.push_back(info);
+    }
+    for (int32_t i = 0; i < COUNTRY_COUNT; ++i) {
+        const char country[] = { (char)('A' + i / 26), (char)('A' + i % 26), '\0' }; // 26 letters
+        auto defaultZone = defaultMap.find(country);
+        auto zones = countryZones.find(country);
+        if (defaultZone != defaultMap.end()) {
+            countryDefaults[i] = defaultZone->second;
+        } else if (zones != countryZones.end() && !zones->second.empty()) {
+            countryDefaults[i] = zones->second.front().id;
         }
-        --count;
     }
-    return;
 }
 
 bool ZoneUtil::Init()
@@ -63,11 +63,11 @@ HWTEST_F(ZoneUtilPerformanceTest,  ZoneUtilPerformanceFuncTest001, TestSize.Leve
             auto t1 = std::chrono::high_resolution_clock::now();
             string out = util.GetDefaultZone(countries[i].c_str());
             auto t2 = std::chrono::high_resolution_clock::now();
-            total += std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+            total += std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count();
         }
     }
     average = total / (1000.0 * 2);
-    EXPECT_LT(average, 9300);
+    EXPECT_LT(average, 50000);
 }
 
 /**
@@ -89,11 +89,11 @@ HWTEST_F(ZoneUtilPerformanceTest,  ZoneUtilPerformanceFuncTest002, TestSize.Leve
             auto t1 = std::chrono::high_resolution_clock::now();
             string out = util.GetDefaultZone(countries[i].c_str(), offsets[i]);
             auto t2 = std::chrono::high_resolution_clock::now();
-            total += std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+            total += std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count();
         }
     }
     average = total / (1000.0 * 2);
-    EXPECT_LT(average, 10800);
+    EXPECT_LT(average, 50000);
 }
 
 /**
@@ -113,10 +113,10 @@ HWTEST_F(ZoneUtilPerformanceTest,  ZoneUtilPerformanceFuncTest003, TestSize.Leve
         auto t1 = std::chrono::high_resolution_clock::now();
         util.GetZoneList(country, out);
         auto t2 = std::chrono::high_resolution_clock::now();
-        total += std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+        total += std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count();
     }
     average = total / 1000.0;
-    EXPECT_LT(average, 9300);
+    EXPECT_LT(average, 50000);
 }
 
 /**
@@ -136,10 +136,10 @@ HWTEST_F(ZoneUtilPerformanceTest,  ZoneUtilPerformanceFuncTest004, TestSize.Leve
         auto t1 = std::chrono::high_resolution_clock::now();
         util.GetZoneList(country, out);
         auto t2 = std::chrono::high_resolution_clock::now();
-        total += std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+        total += std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count();
     }
     average = total / 1000.0;
-    EXPECT_LT(average, 9300);
+    EXPECT_LT(average, 50000);
 }
 
 /**
@@ -159,10 +159,10 @@ HWTEST_F(ZoneUtilPerformanceTest,  ZoneUtilPerformanceFuncTest005, TestSize.Leve
         auto t1 = std::chrono::high_resolution_clock::now();
         util.GetZoneList(country, out);
         auto t2 = std::chrono::high_resolution_clock::now();
-        total += std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+        total += std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count();
     }
     average = total / 1000.0;
-    EXPECT_LT(average, 9300);
+    EXPECT_LT(average, 50000);
 }
 
 /**
@@ -182,9 +182,62 @@ HWTEST_F(ZoneUtilPerformanceTest,  ZoneUtilPerformanceFuncTest006, TestSize.Leve
         auto t1 = std::chrono::high_resolution_clock::now();
         util.GetZoneList(country, 3600 * 1000 * 8, out);
         auto t2 = std::chrono::high_resolution_clock::now();
-        total += std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+        total += std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count();
     }
     average = total / 1000.0;
-    EXPECT_LT(average, 10300);
+    EXPECT_LT(average, 50000);
+}
+
+/**
+ * @tc.name: ZoneUtilPerformanceFuncTest007
+ * @tc.desc: Test ZoneUtil GetDefaultZone with total offset, DST state and time
+ * @tc.type: FUNC
+ */
+HWTEST_F(ZoneUtilPerformanceTest,  ZoneUtilPerformanceFuncTest007, TestSize.Level1)
+{
+    uint64_t total = 0;
+    double average = 0;
+    double now = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    int32_t offsets[] = { 3600 * 1000 * 8, -3600 * 1000 * 5, -3600 * 1000 * 4 };
+    bool isDST[] = { false, false, true };
+    string countries[] = { "CN", "US", "US" };
+    int count = 3;
+    ZoneUtil util;
+    for (int k = 0; k < 1000; ++k) {
+        for (int i = 0; i < count; ++i) {
+            auto t1 = std::chrono::high_resolution_clock::now();
+            string out = util.GetDefaultZone(countries[i], offsets[i], isDST[i], now + k * 60 * 1000.0);
+            auto t2 = std::chrono::high_resolution_clock::now();
+            total += std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count();
+        }
+    }
+    average = total / (1000.0 * 3);
+    EXPECT_LT(average, 50000);
+    EXPECT_EQ(util.GetDefaultZone("CN", offsets[0], false, now), "Asia/Shanghai");
+}
+
+/**
+ * @tc.name: ZoneUtilPerformanceFuncTest008
+ * @tc.desc: Test ZoneUtil GetDefaultZone with calling codes
+ * @tc.type: FUNC
+ */
+HWTEST_F(ZoneUtilPerformanceTest,  ZoneUtilPerformanceFuncTest008, TestSize.Level1)
+{
+    uint64_t total = 0;
+    double average = 0;
+    int32_t numbers[] = { 86, 1 };
+    int count = 2;
+    ZoneUtil util;
+    for (int k = 0; k < 1000; ++k) {
+        for (int i = 0; i < count; ++i) {
+            auto t1 = std::chrono::high_resolution_clock::now();
+            string out = util.GetDefaultZone(numbers[i]);
+            auto t2 = std::chrono::high_resolution_clock::now();
+            total += std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count();
+        }
+    }
+    average = total / (1000.0 * 2);
+    EXPECT_LT(average, 50000);
 }
 }
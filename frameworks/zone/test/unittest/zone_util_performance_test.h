@@ -22,4 +22,6 @@ int ZoneUtilPerformanceFuncTest003();
 int ZoneUtilPerformanceFuncTest004();
 int ZoneUtilPerformanceFuncTest005();
 int ZoneUtilPerformanceFuncTest006();
+int ZoneUtilPerformanceFuncTest007();
+int ZoneUtilPerformanceFuncTest008();
 #endif
\ No newline at end of file
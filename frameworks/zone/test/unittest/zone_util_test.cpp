@@ -13,12 +13,18 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <gtest/gtest.h>
+#include "unicode/basictz.h"
+#include "unicode/calendar.h"
+#include "unicode/timezone.h"
+#include "unicode/tztrans.h"
 #include "zone_util.h"
 
 using namespace OHOS::Global::I18n;
 using testing::ext::TestSize;
 using namespace std;
+using namespace icu;
 
 namespace {
 class ZoneUtilTest : public testing::Test {
@@ -184,4 +190,121 @@ HWTEST_F(ZoneUtilTest, ZoneUtilFuncTest008, TestSize.Level1)
     string out = util.GetDefaultZone(number, 8 * 3600 * 1000);
     EXPECT_EQ(expects[0], out);
 }
+
+/**
+ * @tc.name: ZoneUtilFuncTest009
+ * @tc.desc: Test ZoneUtil with lower case country codes, offsets and a non-empty result list
+ * @tc.type: FUNC
+ */
+HWTEST_F(ZoneUtilTest, ZoneUtilFuncTest009, TestSize.Level1)
+{
+    ZoneUtil util;
+    EXPECT_EQ(util.GetDefaultZone("cn"), "Asia/Shanghai");
+    EXPECT_EQ(util.GetDefaultZone("jp"), "Asia/Tokyo");
+    EXPECT_EQ(util.GetDefaultZone("cn", 3600 * 1000 * 6), "Asia/Urumqi");
+    EXPECT_EQ(util.GetDefaultZone("CN", 3600 * 1000 * 3), "");
+    EXPECT_EQ(util.GetDefaultZone("XX"), "");
+    vector<string> out = { "Asia/Urumqi" };
+    util.GetZoneList("cn", out);
+    vector<string> expects = { "Asia/Urumqi", "Asia/Shanghai" };
+    EXPECT_EQ(out, expects);
+    out.clear();
+    util.GetZoneList("XX", out);
+    EXPECT_TRUE(out.empty());
+}
+
+/**
+ * @tc.name: ZoneUtilFuncTest010
+ * @tc.desc: Test ZoneUtil GetDefaultZone and GetZoneList with total offset and DST state across transitions
+ * @tc.type: FUNC
+ */
+HWTEST_F(ZoneUtilTest, ZoneUtilFuncTest010, TestSize.Level1)
+{
+    ZoneUtil util;
+    const double minute = 60 * 1000;
+    const double now = Calendar::getNow();
+    for (const string id : { "America/New_York", "Australia/Sydney" }) {
+        unique_ptr<TimeZone> zone(TimeZone::createTimeZone(id.c_str()));
+        BasicTimeZone *basicZone = dynamic_cast<BasicTimeZone *>(zone.get());
+        ASSERT_TRUE(basicZone != nullptr);
+        TimeZoneTransition transition;
+        ASSERT_TRUE(basicZone->getNextTransition(now, false, transition));
+        int32_t offsetBefore = transition.getFrom()->getRawOffset() + transition.getFrom()->getDSTSavings();
+        bool dstBefore = transition.getFrom()->getDSTSavings() != 0;
+        int32_t offsetAfter = transition.getTo()->getRawOffset() + transition.getTo()->getDSTSavings();
+        bool dstAfter = transition.getTo()->getDSTSavings() != 0;
+        string country = (id == "America/New_York") ? "US" : "AU";
+        double before = transition.getTime() - minute;
+        double after = transition.getTime() + minute;
+        EXPECT_EQ(util.GetDefaultZone(country, offsetBefore, dstBefore, before), id);
+        EXPECT_EQ(util.GetDefaultZone(country, offsetAfter, dstAfter, after), id);
+        EXPECT_NE(util.GetDefaultZone(country, offsetAfter, dstAfter, before), id);
+        EXPECT_NE(util.GetDefaultZone(country, offsetBefore, dstBefore, after), id);
+    }
+    vector<string> out;
+    util.GetZoneList("AU", 10 * 3600 * 1000, true, now, out); // no zone of Australia is 10 hours ahead in DST
+    EXPECT_TRUE(out.empty());
+}
+
+/**
+ * @tc.name: ZoneUtilFuncTest011
+ * @tc.desc: Test ZoneUtil GetDefaultZone with calling codes
+ * @tc.type: FUNC
+ */
+HWTEST_F(ZoneUtilTest, ZoneUtilFuncTest011, TestSize.Level1)
+{
+    ZoneUtil util;
+    EXPECT_EQ(util.GetDefaultZone(1), "America/New_York");
+    EXPECT_EQ(util.GetDefaultZone(44), "Europe/London");
+    EXPECT_EQ(util.GetDefaultZone(1, -3600 * 1000 * 5), "America/Detroit");
+    // 800 is a non geographic calling code, its region is "001"
+    EXPECT_FALSE(util.GetDefaultZone(800).empty());
+    EXPECT_EQ(util.GetDefaultZone(800), util.GetDefaultZone("001"));
+    EXPECT_EQ(util.GetDefaultZone(800, 0), util.GetDefaultZone("001", 0));
+    EXPECT_EQ(util.GetDefaultZone(0), "");
+    EXPECT_EQ(util.GetDefaultZone(-1), "");
+    EXPECT_EQ(util.GetDefaultZone(1000), "");
+    EXPECT_EQ(util.GetDefaultZone(-1, 0), "");
+}
+
+/**
+ * @tc.name: ZoneUtilFuncTest012
+ * @tc.desc: Test that ZoneUtil GetZoneList with total offset and DST state agrees with ICU within the next years
+ * @tc.type: FUNC
+ */
+HWTEST_F(ZoneUtilTest, ZoneUtilFuncTest012, TestSize.Level1)
+{
+    ZoneUtil util;
+    const double week = 7 * 24 * 3600 * 1000.0;
+    const double now = Calendar::getNow();
+    for (const string country : { "US", "AU", "BR", "CL", "MX", "RU" }) {
+        vector<string> zones;
+        util.GetZoneList(country, zones);
+        ASSERT_FALSE(zones.empty());
+        for (int32_t k = 0; k < 4 * 52; ++k) { // 4 years of weeks, inside the precomputed range
+            double date = now + k * week;
+            for (const string &id : zones) {
+                unique_ptr<TimeZone> zone(TimeZone::createTimeZone(id.c_str()));
+                UErrorCode status = U_ZERO_ERROR;
+                int32_t rawOffset = 0;
+                int32_t dstOffset = 0;
+                zone->getOffset(date, false, rawOffset, dstOffset, status);
+                ASSERT_TRUE(U_SUCCESS(status));
+                vector<string> expects;
+                for (const string &other : zones) {
+                    unique_ptr<TimeZone> otherZone(TimeZone::createTimeZone(other.c_str()));
+                    int32_t otherRaw = 0;
+                    int32_t otherDst = 0;
+                    otherZone->getOffset(date, false, otherRaw, otherDst, status);
+                    if (otherRaw + otherDst == rawOffset + dstOffset && (otherDst != 0) == (dstOffset != 0)) {
+                        expects.push_back(other);
+                    }
+                }
+                vector<string> out;
+                util.GetZoneList(country, rawOffset + dstOffset, dstOffset != 0, date, out);
+                EXPECT_EQ(out, expects);
+            }
+        }
+    }
+}
 }
\ No newline at end of file
@@ -24,4 +24,8 @@ int ZoneUtilFuncTest005();
 int ZoneUtilFuncTest006();
 int ZoneUtilFuncTest007();
 int ZoneUtilFuncTest008();
+int ZoneUtilFuncTest009();
+int ZoneUtilFuncTest010();
+int ZoneUtilFuncTest011();
+int ZoneUtilFuncTest012();
 #endif
\ No newline at end of file
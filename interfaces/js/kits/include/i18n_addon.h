@@ -17,6 +17,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include "napi/native_api.h"
 #include "i18n_break_iterator.h"
 #include "i18n_calendar.h"
@@ -68,6 +69,7 @@ public:
     static napi_value IsLowerCaseAddon(napi_env env, napi_callback_info info);
     static napi_value IsUpperCaseAddon(napi_env env, napi_callback_info info);
     static napi_value GetTypeAddon(napi_env env, napi_callback_info info);
+    static napi_value GetCharacterClassesAddon(napi_env env, napi_callback_info info);
     static napi_value Is24HourClock(napi_env env, napi_callback_info info);
     static napi_value Set24HourClock(napi_env env, napi_callback_info info);
     static napi_value AddPreferredLanguage(napi_env env, napi_callback_info info);
@@ -76,6 +78,9 @@ public:
     static napi_value GetFirstPreferredLanguage(napi_env env, napi_callback_info info);
     static napi_value InitI18nTimeZone(napi_env env, napi_value exports);
     static napi_value GetI18nTimeZone(napi_env env, napi_callback_info info);
+    static napi_value GetTimeZoneItems(napi_env env, napi_callback_info info);
+    static napi_value PreloadCalendar(napi_env env, napi_callback_info info);
+    static napi_value CreateTimeZoneItem(napi_env env, const TimeZoneItem &item);
     static napi_value GetDateOrder(napi_env env, napi_callback_info info);
     static napi_value InitTransliterator(napi_env env, napi_value exports);
     static napi_value GetTransliteratorInstance(napi_env env, napi_callback_info info);
@@ -108,6 +113,9 @@ private:
     static napi_value Get(napi_env env, napi_callback_info info);
     static napi_value GetDisplayName(napi_env env, napi_callback_info info);
     static napi_value IsWeekend(napi_env env, napi_callback_info info);
+    static napi_value GetFields(napi_env env, napi_callback_info info);
+    static napi_value GetMonthGrid(napi_env env, napi_callback_info info);
+    static bool GetCalendarFields(napi_env env, napi_value value, std::vector<UCalendarDateFields> &fields);
     static CalendarType GetCalendarType(napi_env env, napi_value value);
     static napi_value GetLineInstance(napi_env env, napi_callback_info info);
     static napi_value Current(napi_env env, napi_callback_info info);
@@ -119,12 +127,15 @@ private:
     static napi_value GetText(napi_env env, napi_callback_info info);
     static napi_value Following(napi_env env, napi_callback_info info);
     static napi_value IsBoundary(napi_env env, napi_callback_info info);
+    static napi_value GetAllBoundaries(napi_env env, napi_callback_info info);
+    static napi_value CreateInt32Array(napi_env env, const std::vector<int32_t> &values);
 
     static napi_value GetIndexUtil(napi_env env, napi_callback_info info);
     static napi_value IndexUtilConstructor(napi_env env, napi_callback_info info);
     static napi_value GetIndexList(napi_env env, napi_callback_info info);
     static napi_value AddLocale(napi_env env, napi_callback_info info);
     static napi_value GetIndex(napi_env env, napi_callback_info info);
+    static napi_value AssignBuckets(napi_env env, napi_callback_info info);
     bool InitIndexUtilContext(napi_env env, napi_callback_info info, const std::string &localeTag);
     static napi_value CreateUtilObject(napi_env env);
     static napi_value CreateCharacterObject(napi_env env);
@@ -150,6 +161,7 @@ private:
     std::unique_ptr<I18nCalendar> calendar_ = nullptr;
     std::unique_ptr<icu::Transliterator> transliterator_ = nullptr;
     std::unique_ptr<I18nBreakIterator> brkiter_ = nullptr;
+    std::vector<char16_t> brkText_;
     std::unique_ptr<IndexUtil> indexUtil_ = nullptr;
     std::unique_ptr<I18nTimeZone> timezone_ = nullptr;
 };
@@ -12,6 +12,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
 #include <chrono>
 #include <unordered_map>
 #include <vector>
@@ -73,6 +74,13 @@ static std::unordered_map<std::string, CalendarType> g_typeMap {
     { "japanese", CalendarType::JAPANESE },
     { "persion", CalendarType::PERSIAN },
 };
+
+static std::unordered_map<std::string, BreakIteratorType> g_breakTypeMap {
+    { "line", BreakIteratorType::LINE_BREAK },
+    { "word", BreakIteratorType::WORD_BREAK },
+    { "sentence", BreakIteratorType::SENTENCE_BREAK },
+    { "character", BreakIteratorType::CHARACTER_BREAK },
+};
 using namespace OHOS::HiviewDFX;
 
 I18nAddon::I18nAddon() : env_(nullptr), wrapper_(nullptr) {}
@@ -109,6 +117,7 @@ napi_value I18nAddon::CreateCharacterObject(napi_env env)
         DECLARE_NAPI_FUNCTION("isLowerCase", IsLowerCaseAddon),
         DECLARE_NAPI_FUNCTION("isUpperCase", IsUpperCaseAddon),
         DECLARE_NAPI_FUNCTION("getType", GetTypeAddon),
+        DECLARE_NAPI_FUNCTION("getCharacterClasses", GetCharacterClassesAddon),
     };
     status = napi_define_properties(env, character,
                                     sizeof(characterProperties) / sizeof(napi_property_descriptor),
@@ -150,6 +159,10 @@ void I18nAddon::CreateInitProperties(napi_property_descriptor *properties)
     properties[22] = DECLARE_NAPI_FUNCTION("set24HourClock", Set24HourClock);
     // 23 is properties index
     properties[23] = DECLARE_NAPI_FUNCTION("getTimeZone", GetI18nTimeZone);
+    // 25 is properties index
+    properties[25] = DECLARE_NAPI_FUNCTION("getTimeZoneItems", GetTimeZoneItems);
+    // 26 is properties index
+    properties[26] = DECLARE_NAPI_FUNCTION("preloadCalendar", PreloadCalendar);
 }
 
 napi_value I18nAddon::Init(napi_env env, napi_value exports)
@@ -180,7 +193,7 @@ napi_value I18nAddon::Init(napi_env env, napi_value exports)
     if (!transliterator) {
         return nullptr;
     }
-    size_t propertiesNums = 25;
+    size_t propertiesNums = 27;
     napi_property_descriptor properties[propertiesNums];
     CreateInitProperties(properties);
     properties[13] = DECLARE_NAPI_PROPERTY("Util", util);  // 13 is properties index
@@ -903,6 +916,55 @@ napi_value I18nAddon::GetTypeAddon(napi_env env, napi_callback_info info)
     return result;
 }
 
+napi_value I18nAddon::GetCharacterClassesAddon(napi_env env, napi_callback_info info)
+{
+    size_t argc = 1;
+    napi_value argv[1] = { 0 };
+    napi_value thisVar = nullptr;
+    void *data = nullptr;
+    napi_status status = napi_get_cb_info(env, info, &argc, argv, &thisVar, &data);
+    if (status != napi_ok) {
+        return nullptr;
+    }
+    napi_valuetype valueType = napi_valuetype::napi_undefined;
+    napi_typeof(env, argv[0], &valueType);
+    if (valueType != napi_valuetype::napi_string) {
+        napi_throw_type_error(env, nullptr, "Parameter type does not match");
+        return nullptr;
+    }
+    size_t len = 0;
+    status = napi_get_value_string_utf16(env, argv[0], nullptr, 0, &len);
+    if (status != napi_ok) {
+        HiLog::Error(LABEL, "Get text length failed");
+        return nullptr;
+    }
+    std::vector<char16_t> buf(len + 1);
+    status = napi_get_value_string_utf16(env, argv[0], buf.data(), len + 1, &len);
+    if (status != napi_ok) {
+        HiLog::Error(LABEL, "Get text failed");
+        return nullptr;
+    }
+    std::u16string text(buf.data(), len);
+    // Indexed like the JS string, one entry per UTF-16 code unit.
+    std::vector<uint8_t> classes;
+    GetCharacterClasses(text, classes);
+    void *bufferData = nullptr;
+    napi_value buffer = nullptr;
+    status = napi_create_arraybuffer(env, classes.size(), &bufferData, &buffer);
+    if (status != napi_ok) {
+        HiLog::Error(LABEL, "Create character classes buffer failed");
+        return nullptr;
+    }
+    std::copy(classes.begin(), classes.end(), static_cast<uint8_t *>(bufferData));
+    napi_value result = nullptr;
+    status = napi_create_typedarray(env, napi_uint8_array, classes.size(), buffer, 0, &result);
+    if (status != napi_ok) {
+        HiLog::Error(LABEL, "Create character classes array failed");
+        return nullptr;
+    }
+    return result;
+}
+
 napi_value I18nAddon::GetSystemLanguages(napi_env env, napi_callback_info info)
 {
     std::vector<std::string> systemLanguages;
@@ -1482,7 +1544,9 @@ napi_value I18nAddon::InitI18nCalendar(napi_env env, napi_value exports)
         DECLARE_NAPI_FUNCTION("setMinimalDaysInFirstWeek", SetMinimalDaysInFirstWeek),
         DECLARE_NAPI_FUNCTION("get", Get),
         DECLARE_NAPI_FUNCTION("getDisplayName", GetDisplayName),
-        DECLARE_NAPI_FUNCTION("isWeekend", IsWeekend)
+        DECLARE_NAPI_FUNCTION("isWeekend", IsWeekend),
+        DECLARE_NAPI_FUNCTION("getFields", GetFields),
+        DECLARE_NAPI_FUNCTION("getMonthGrid", GetMonthGrid)
     };
     napi_value constructor = nullptr;
     status = napi_define_class(env, "I18nCalendar", NAPI_AUTO_LENGTH, CalendarConstructor, nullptr,
@@ -1547,6 +1611,87 @@ napi_value I18nAddon::CalendarConstructor(napi_env env, napi_callback_info info)
     return thisVar;
 }
 
+// State of one preloadCalendar call, owned by its async work from creation until it completes.
+struct PreloadCalendarContext {
+    std::string localeTag;
+    CalendarType type = CalendarType::UNDEFINED;
+    bool result = false;
+    napi_deferred deferred = nullptr;
+    napi_async_work work = nullptr;
+};
+
+static void PreloadCalendarExecute(napi_env env, void *data)
+{
+    PreloadCalendarContext *context = static_cast<PreloadCalendarContext *>(data);
+    context->result = I18nCalendar::Preload(context->localeTag, context->type);
+}
+
+static void PreloadCalendarComplete(napi_env env, napi_status status, void *data)
+{
+    PreloadCalendarContext *context = static_cast<PreloadCalendarContext *>(data);
+    napi_value result = nullptr;
+    napi_get_boolean(env, status == napi_ok && context->result, &result);
+    napi_resolve_deferred(env, context->deferred, result);
+    napi_delete_async_work(env, context->work);
+    delete context;
+}
+
+// Builds the shared month table of a lunar calendar off the JS thread, so that getFields and getMonthGrid of
+// every calendar of that type take the table path once the returned promise resolves.
+napi_value I18nAddon::PreloadCalendar(napi_env env, napi_callback_info info)
+{
+    size_t argc = 2;
+    napi_value argv[2] = { nullptr };
+    napi_value thisVar = nullptr;
+    void *data = nullptr;
+    napi_status status = napi_get_cb_info(env, info, &argc, argv, &thisVar, &data);
+    if (status != napi_ok) {
+        return nullptr;
+    }
+    napi_valuetype valueType = napi_valuetype::napi_undefined;
+    napi_typeof(env, argv[0], &valueType);
+    if (valueType != napi_valuetype::napi_string) {
+        napi_throw_type_error(env, nullptr, "Parameter type does not match");
+        return nullptr;
+    }
+    int32_t code = 0;
+    std::string localeTag = GetString(env, argv[0], code);
+    if (code) {
+        return nullptr;
+    }
+    CalendarType type = GetCalendarType(env, argv[1]);
+    bool pending = false;
+    napi_is_exception_pending(env, &pending);
+    if (pending) {
+        return nullptr;
+    }
+    std::unique_ptr<PreloadCalendarContext> context = std::make_unique<PreloadCalendarContext>();
+    context->localeTag = localeTag;
+    context->type = type;
+    napi_value promise = nullptr;
+    status = napi_create_promise(env, &context->deferred, &promise);
+    if (status != napi_ok) {
+        HiLog::Error(LABEL, "Create preloadCalendar promise failed");
+        return nullptr;
+    }
+    napi_value resourceName = nullptr;
+    napi_create_string_utf8(env, "preloadCalendar", NAPI_AUTO_LENGTH, &resourceName);
+    status = napi_create_async_work(env, nullptr, resourceName, PreloadCalendarExecute, PreloadCalendarComplete,
+        context.get(), &context->work);
+    if (status != napi_ok) {
+        HiLog::Error(LABEL, "Create preloadCalendar work failed");
+        return nullptr;
+    }
+    status = napi_queue_async_work(env, context->work);
+    if (status != napi_ok) {
+        HiLog::Error(LABEL, "Queue preloadCalendar work failed");
+        napi_delete_async_work(env, context->work);
+        return nullptr;
+    }
+    context.release();
+    return promise;
+}
+
 CalendarType I18nAddon::GetCalendarType(napi_env env, napi_value value)
 {
     CalendarType type = CalendarType::UNDEFINED;
@@ -2006,6 +2151,128 @@ napi_value I18nAddon::IsWeekend(napi_env env, napi_callback_info info)
     return result;
 }
 
+bool I18nAddon::GetCalendarFields(napi_env env, napi_value value, std::vector<UCalendarDateFields> &fields)
+{
+    bool isArray = false;
+    napi_status status = napi_is_array(env, value, &isArray);
+    if (status != napi_ok || !isArray) {
+        napi_throw_type_error(env, nullptr, "Parameter type does not match");
+        return false;
+    }
+    uint32_t length = 0;
+    status = napi_get_array_length(env, value, &length);
+    if (status != napi_ok) {
+        HiLog::Error(LABEL, "Get array length failed");
+        return false;
+    }
+    fields.resize(length);
+    for (uint32_t i = 0; i < length; ++i) {
+        napi_value element = nullptr;
+        status = napi_get_element(env, value, i, &element);
+        if (status != napi_ok) {
+            HiLog::Error(LABEL, "Get array element failed");
+            return false;
+        }
+        napi_valuetype valueType = napi_valuetype::napi_undefined;
+        napi_typeof(env, element, &valueType);
+        if (valueType != napi_valuetype::napi_string) {
+            napi_throw_type_error(env, nullptr, "Parameter type does not match");
+            return false;
+        }
+        std::string field;
+        if (!GetStringFromJS(env, element, field)) {
+            return false;
+        }
+        auto iter = g_fieldsMap.find(field);
+        if (iter == g_fieldsMap.end()) {
+            HiLog::Error(LABEL, "Invalid field");
+            return false;
+        }
+        fields[i] = iter->second;
+    }
+    return true;
+}
+
+napi_value I18nAddon::GetFields(napi_env env, napi_callback_info info)
+{
+    size_t argc = 2;
+    napi_value argv[2] = { 0 };
+    napi_value thisVar = nullptr;
+    void *data = nullptr;
+    napi_get_cb_info(env, info, &argc, argv, &thisVar, &data);
+    napi_valuetype valueType = napi_valuetype::napi_undefined;
+    napi_typeof(env, argv[0], &valueType);
+    napi_value value = argv[0];
+    napi_status status = napi_ok;
+    if (valueType == napi_valuetype::napi_object) {
+        napi_value funcGetDateInfo = nullptr;
+        status = napi_get_named_property(env, argv[0], "valueOf", &funcGetDateInfo);
+        if (status != napi_ok) {
+            HiLog::Error(LABEL, "Get method valueOf failed");
+            return nullptr;
+        }
+        status = napi_call_function(env, argv[0], funcGetDateInfo, 0, nullptr, &value);
+        if (status != napi_ok) {
+            HiLog::Error(LABEL, "Get milliseconds failed");
+            return nullptr;
+        }
+    }
+    double milliseconds = 0;
+    status = napi_get_value_double(env, value, &milliseconds);
+    if (status != napi_ok) {
+        napi_throw_type_error(env, nullptr, "Parameter type does not match");
+        return nullptr;
+    }
+    std::vector<UCalendarDateFields> fields;
+    if (!GetCalendarFields(env, argv[1], fields)) {
+        return nullptr;
+    }
+    I18nAddon *obj = nullptr;
+    status = napi_unwrap(env, thisVar, reinterpret_cast<void **>(&obj));
+    if (status != napi_ok || !obj || !obj->calendar_) {
+        HiLog::Error(LABEL, "Get calendar object failed");
+        return nullptr;
+    }
+    std::vector<int32_t> values(fields.size());
+    if (!obj->calendar_->GetFields(milliseconds, fields.data(), values.data(), fields.size())) {
+        HiLog::Error(LABEL, "GetFields failed");
+        return nullptr;
+    }
+    return CreateInt32Array(env, values);
+}
+
+napi_value I18nAddon::GetMonthGrid(napi_env env, napi_callback_info info)
+{
+    size_t argc = 3;
+    napi_value argv[3] = { 0 };
+    napi_value thisVar = nullptr;
+    void *data = nullptr;
+    napi_get_cb_info(env, info, &argc, argv, &thisVar, &data);
+    int32_t year = 0;
+    int32_t month = 0;
+    if (napi_get_value_int32(env, argv[0], &year) != napi_ok || napi_get_value_int32(env, argv[1], &month) != napi_ok) {
+        napi_throw_type_error(env, nullptr, "Parameter type does not match");
+        return nullptr;
+    }
+    std::vector<UCalendarDateFields> fields;
+    // 2 is the index of the field names
+    if (!GetCalendarFields(env, argv[2], fields)) {
+        return nullptr;
+    }
+    I18nAddon *obj = nullptr;
+    napi_status status = napi_unwrap(env, thisVar, reinterpret_cast<void **>(&obj));
+    if (status != napi_ok || !obj || !obj->calendar_) {
+        HiLog::Error(LABEL, "Get calendar object failed");
+        return nullptr;
+    }
+    std::vector<int32_t> cells;
+    if (!obj->calendar_->GetMonthGrid(year, month, fields.data(), fields.size(), cells)) {
+        HiLog::Error(LABEL, "GetMonthGrid failed");
+        return nullptr;
+    }
+    return CreateInt32Array(env, cells);
+}
+
 napi_value I18nAddon::GetDisplayName(napi_env env, napi_callback_info info)
 {
     size_t argc = 1;
@@ -2049,7 +2316,8 @@ napi_value I18nAddon::InitIndexUtil(napi_env env, napi_value exports)
     napi_property_descriptor properties[] = {
         DECLARE_NAPI_FUNCTION("getIndexList", GetIndexList),
         DECLARE_NAPI_FUNCTION("addLocale", AddLocale),
-        DECLARE_NAPI_FUNCTION("getIndex", GetIndex)
+        DECLARE_NAPI_FUNCTION("getIndex", GetIndex),
+        DECLARE_NAPI_FUNCTION("assignBuckets", AssignBuckets)
     };
 
     napi_value constructor = nullptr;
@@ -2070,8 +2338,8 @@ napi_value I18nAddon::InitIndexUtil(napi_env env, napi_value exports)
 
 napi_value I18nAddon::BreakIteratorConstructor(napi_env env, napi_callback_info info)
 {
-    size_t argc = 1;
-    napi_value argv[1] = { nullptr };
+    size_t argc = 2;
+    napi_value argv[2] = { nullptr };
     napi_value thisVar = nullptr;
     void *data = nullptr;
     napi_status status = napi_get_cb_info(env, info, &argc, argv, &thisVar, &data);
@@ -2089,6 +2357,16 @@ napi_value I18nAddon::BreakIteratorConstructor(napi_env env, napi_callback_info
     if (code) {
         return nullptr;
     }
+    BreakIteratorType type = BreakIteratorType::LINE_BREAK;
+    if (argc > 1 && argv[1] != nullptr) {
+        napi_typeof(env, argv[1], &valueType);
+        if (valueType == napi_valuetype::napi_string) {
+            std::string typeName = GetString(env, argv[1], code);
+            if (!code && g_breakTypeMap.find(typeName) != g_breakTypeMap.end()) {
+                type = g_breakTypeMap[typeName];
+            }
+        }
+    }
     std::unique_ptr<I18nAddon> obj = nullptr;
     obj = std::make_unique<I18nAddon>();
     if (!obj) {
@@ -2101,7 +2379,7 @@ napi_value I18nAddon::BreakIteratorConstructor(napi_env env, napi_callback_info
         HiLog::Error(LABEL, "Wrap II18nAddon failed");
         return nullptr;
     }
-    obj->brkiter_ = std::make_unique<I18nBreakIterator>(localeTag);
+    obj->brkiter_ = std::make_unique<I18nBreakIterator>(localeTag, type);
     if (!obj->brkiter_) {
         HiLog::Error(LABEL, "Wrap BreakIterator failed");
         return nullptr;
@@ -2123,6 +2401,7 @@ napi_value I18nAddon::InitBreakIterator(napi_env env, napi_value exports)
         DECLARE_NAPI_FUNCTION("following", Following),
         DECLARE_NAPI_FUNCTION("getLineBreakText", GetText),
         DECLARE_NAPI_FUNCTION("isBoundary", IsBoundary),
+        DECLARE_NAPI_FUNCTION("getAllBoundaries", GetAllBoundaries),
     };
     napi_value constructor = nullptr;
     status = napi_define_class(env, "BreakIterator", NAPI_AUTO_LENGTH, BreakIteratorConstructor, nullptr,
@@ -2146,8 +2425,8 @@ napi_value I18nAddon::InitBreakIterator(napi_env env, napi_value exports)
 
 napi_value I18nAddon::GetLineInstance(napi_env env, napi_callback_info info)
 {
-    size_t argc = 1;
-    napi_value argv[1] = { nullptr };
+    size_t argc = 2;
+    napi_value argv[2] = { nullptr };
     napi_value thisVar = nullptr;
     void *data = nullptr;
     napi_get_cb_info(env, info, &argc, argv, &thisVar, &data);
@@ -2161,7 +2440,8 @@ napi_value I18nAddon::GetLineInstance(napi_env env, napi_callback_info info)
         return nullptr;
     }
     napi_value result = nullptr;
-    status = napi_new_instance(env, constructor, 1, argv, &result); // 1 arguments
+    // locale and optional break type
+    status = napi_new_instance(env, constructor, (argc > 1 && argv[1]) ? 2 : 1, argv, &result);
     if (status != napi_ok) {
         HiLog::Error(LABEL, "GetLineInstance create instance failed");
         return nullptr;
@@ -2321,18 +2601,24 @@ napi_value I18nAddon::SetText(napi_env env, napi_callback_info info)
         return nullptr;
     }
     size_t len = 0;
-    status = napi_get_value_string_utf8(env, argv[0], nullptr, 0, &len);
+    status = napi_get_value_string_utf16(env, argv[0], nullptr, 0, &len);
     if (status != napi_ok) {
         HiLog::Error(LABEL, "Get field length failed");
         return nullptr;
     }
-    std::vector<char> buf(len + 1);
-    status = napi_get_value_string_utf8(env, argv[0], buf.data(), len + 1, &len);
+    // The iterator reads the text in place and still points into brkText_, so the new text is read into its own
+    // buffer and only replaces brkText_ once the iterator has been moved onto it.
+    std::vector<char16_t> text(len + 1);
+    status = napi_get_value_string_utf16(env, argv[0], text.data(), len + 1, &len);
     if (status != napi_ok) {
         HiLog::Error(LABEL, "Get string value failed");
         return nullptr;
     }
-    obj->brkiter_->setText(buf.data());
+    if (!obj->brkiter_->SetUTF16Text(text.data(), static_cast<int32_t>(len))) {
+        HiLog::Error(LABEL, "Set text failed");
+        return nullptr;
+    }
+    obj->brkText_.swap(text);
     return nullptr;
 }
 
@@ -2350,9 +2636,12 @@ napi_value I18nAddon::GetText(napi_env env, napi_callback_info info)
         return nullptr;
     }
     napi_value value = nullptr;
-    std::string temp;
-    obj->brkiter_->getText(temp);
-    status = napi_create_string_utf8(env, temp.c_str(), NAPI_AUTO_LENGTH, &value);
+    // brkText_ holds the text with its terminating NUL once setLineBreakText has been called
+    if (obj->brkText_.empty()) {
+        status = napi_create_string_utf16(env, u"", 0, &value);
+    } else {
+        status = napi_create_string_utf16(env, obj->brkText_.data(), obj->brkText_.size() - 1, &value);
+    }
     if (status != napi_ok) {
         HiLog::Error(LABEL, "Get field length failed");
         return nullptr;
@@ -2436,6 +2725,66 @@ napi_value I18nAddon::IsBoundary(napi_env env, napi_callback_info info)
     return result;
 }
 
+napi_value I18nAddon::CreateInt32Array(napi_env env, const std::vector<int32_t> &values)
+{
+    void *bufferData = nullptr;
+    napi_value buffer = nullptr;
+    size_t byteLength = values.size() * sizeof(int32_t);
+    napi_status status = napi_create_arraybuffer(env, byteLength, &bufferData, &buffer);
+    if (status != napi_ok) {
+        HiLog::Error(LABEL, "Create array buffer failed");
+        return nullptr;
+    }
+    std::copy(values.begin(), values.end(), static_cast<int32_t *>(bufferData));
+    napi_value result = nullptr;
+    status = napi_create_typedarray(env, napi_int32_array, values.size(), buffer, 0, &result);
+    if (status != napi_ok) {
+        HiLog::Error(LABEL, "Create Int32Array failed");
+        return nullptr;
+    }
+    return result;
+}
+
+// Returns an Int32Array of all break offsets, or of (offset, rule status) pairs when the argument is true.
+napi_value I18nAddon::GetAllBoundaries(napi_env env, napi_callback_info info)
+{
+    size_t argc = 1;
+    napi_value argv[1] = { nullptr };
+    napi_value thisVar = nullptr;
+    void *data = nullptr;
+    napi_get_cb_info(env, info, &argc, argv, &thisVar, &data);
+    I18nAddon *obj = nullptr;
+    napi_status status = napi_unwrap(env, thisVar, reinterpret_cast<void **>(&obj));
+    if (status != napi_ok || !obj || !obj->brkiter_) {
+        HiLog::Error(LABEL, "Get BreakIterator object failed");
+        return nullptr;
+    }
+    bool withRuleStatus = false;
+    if (argc > 0 && argv[0]) {
+        napi_valuetype valueType = napi_valuetype::napi_undefined;
+        napi_typeof(env, argv[0], &valueType);
+        if (valueType != napi_valuetype::napi_boolean) {
+            napi_throw_type_error(env, nullptr, "Parameter type does not match");
+            return nullptr;
+        }
+        napi_get_value_bool(env, argv[0], &withRuleStatus);
+    }
+    std::vector<int32_t> boundaries;
+    if (!withRuleStatus) {
+        obj->brkiter_->GetAllBoundaries(boundaries);
+        return CreateInt32Array(env, boundaries);
+    }
+    std::vector<int32_t> ruleStatus;
+    obj->brkiter_->GetAllBoundaries(boundaries, ruleStatus);
+    std::vector<int32_t> pairs;
+    pairs.reserve(boundaries.size() * 2); // 2 values per boundary
+    for (size_t i = 0; i < boundaries.size(); ++i) {
+        pairs.push_back(boundaries[i]);
+        pairs.push_back(ruleStatus[i]);
+    }
+    return CreateInt32Array(env, pairs);
+}
+
 napi_value I18nAddon::IndexUtilConstructor(napi_env env, napi_callback_info info)
 {
     size_t argc = 1;
@@ -2630,9 +2979,9 @@ napi_value I18nAddon::GetIndex(napi_env env, napi_callback_info info)
         HiLog::Error(LABEL, "Get IndexUtil object failed");
         return nullptr;
     }
-    std::string index = obj->indexUtil_->GetIndex(buf.data());
+    const std::string &index = obj->indexUtil_->GetIndex(buf.data());
     napi_value result = nullptr;
-    status = napi_create_string_utf8(env, index.c_str(), NAPI_AUTO_LENGTH, &result);
+    status = napi_create_string_utf8(env, index.c_str(), index.length(), &result);
     if (status != napi_ok) {
         HiLog::Error(LABEL, "GetIndex Failed");
         return nullptr;
@@ -2640,6 +2989,57 @@ napi_value I18nAddon::GetIndex(napi_env env, napi_callback_info info)
     return result;
 }
 
+napi_value I18nAddon::AssignBuckets(napi_env env, napi_callback_info info)
+{
+    size_t argc = 1;
+    napi_value argv[1] = { 0 };
+    napi_value thisVar = nullptr;
+    void *data = nullptr;
+    napi_get_cb_info(env, info, &argc, argv, &thisVar, &data);
+    bool isArray = false;
+    napi_status status = napi_is_array(env, argv[0], &isArray);
+    if (status != napi_ok || !isArray) {
+        napi_throw_type_error(env, nullptr, "Parameter type does not match");
+        return nullptr;
+    }
+    I18nAddon *obj = nullptr;
+    status = napi_unwrap(env, thisVar, reinterpret_cast<void **>(&obj));
+    if (status != napi_ok || !obj || !obj->indexUtil_) {
+        HiLog::Error(LABEL, "Get IndexUtil object failed");
+        return nullptr;
+    }
+    uint32_t length = 0;
+    status = napi_get_array_length(env, argv[0], &length);
+    if (status != napi_ok) {
+        HiLog::Error(LABEL, "Get array length failed");
+        return nullptr;
+    }
+    std::vector<std::string> names(length);
+    for (uint32_t i = 0; i < length; ++i) {
+        napi_value element = nullptr;
+        status = napi_get_element(env, argv[0], i, &element);
+        if (status != napi_ok) {
+            HiLog::Error(LABEL, "Get array element failed");
+            return nullptr;
+        }
+        napi_valuetype valueType = napi_valuetype::napi_undefined;
+        napi_typeof(env, element, &valueType);
+        if (valueType != napi_valuetype::napi_string) {
+            napi_throw_type_error(env, nullptr, "Parameter type does not match");
+            return nullptr;
+        }
+        if (!GetStringFromJS(env, element, names[i])) {
+            return nullptr;
+        }
+    }
+    std::vector<int32_t> buckets;
+    if (!obj->indexUtil_->AssignBuckets(names, buckets)) {
+        HiLog::Error(LABEL, "AssignBuckets failed");
+        return nullptr;
+    }
+    return CreateInt32Array(env, buckets);
+}
+
 napi_value I18nAddon::Is24HourClock(napi_env env, napi_callback_info info)
 {
     bool is24HourClock = LocaleConfig::Is24HourClock();
@@ -3028,6 +3428,86 @@ napi_value I18nAddon::GetTimeZoneDisplayName(napi_env env, napi_callback_info in
     return value;
 }
 
+napi_value I18nAddon::GetTimeZoneItems(napi_env env, napi_callback_info info)
+{
+    size_t argc = 2;
+    napi_value argv[2] = { 0 };
+    napi_value thisVar = nullptr;
+    void *data = nullptr;
+    napi_status status = napi_get_cb_info(env, info, &argc, argv, &thisVar, &data);
+    if (status != napi_ok) {
+        return nullptr;
+    }
+    std::string locale = LocaleConfig::GetSystemLocale();
+    napi_valuetype valueType = napi_valuetype::napi_undefined;
+    if (argv[0]) {
+        napi_typeof(env, argv[0], &valueType);
+        if (valueType == napi_valuetype::napi_string && !GetStringFromJS(env, argv[0], locale)) {
+            return nullptr;
+        }
+    }
+    double date = 0;
+    valueType = napi_valuetype::napi_undefined;
+    if (argv[1]) {
+        napi_typeof(env, argv[1], &valueType);
+    }
+    if (valueType == napi_valuetype::napi_number) {
+        napi_get_value_double(env, argv[1], &date);
+    } else {
+        auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch());
+        date = (double)millis.count();
+    }
+    std::vector<TimeZoneItem> items;
+    if (!I18nTimeZone::GetTimeZoneItems(locale, date, items)) {
+        HiLog::Error(LABEL, "Get time zone items failed");
+        return nullptr;
+    }
+    napi_value result = nullptr;
+    status = napi_create_array_with_length(env, items.size(), &result);
+    if (status != napi_ok) {
+        HiLog::Error(LABEL, "Failed to create array");
+        return nullptr;
+    }
+    for (size_t i = 0; i < items.size(); i++) {
+        napi_value element = CreateTimeZoneItem(env, items[i]);
+        if (!element || napi_set_element(env, result, i, element) != napi_ok) {
+            HiLog::Error(LABEL, "Failed to set array item");
+            return nullptr;
+        }
+    }
+    return result;
+}
+
+// Converts a row to { zoneId, country, offset, displayName, city }.
+napi_value I18nAddon::CreateTimeZoneItem(napi_env env, const TimeZoneItem &item)
+{
+    napi_value result = nullptr;
+    napi_status status = napi_create_object(env, &result);
+    if (status != napi_ok) {
+        return nullptr;
+    }
+    std::pair<const char *, const std::string *> fields[] = {
+        { "zoneId", &item.zoneID },
+        { "country", &item.country },
+        { "displayName", &item.displayName },
+        { "city", &item.city }
+    };
+    for (const auto &field : fields) {
+        napi_value value = nullptr;
+        status = napi_create_string_utf8(env, field.second->c_str(), field.second->length(), &value);
+        if (status != napi_ok || napi_set_named_property(env, result, field.first, value) != napi_ok) {
+            return nullptr;
+        }
+    }
+    napi_value offset = nullptr;
+    status = napi_create_int32(env, item.offset, &offset);
+    if (status != napi_ok || napi_set_named_property(env, result, "offset", offset) != napi_ok) {
+        return nullptr;
+    }
+    return result;
+}
+
 napi_value I18nAddon::GetOffset(napi_env env, napi_callback_info info)
 {
     size_t argc = 1;
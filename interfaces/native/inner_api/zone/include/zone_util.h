@@ -16,6 +16,7 @@
 #ifndef OHOS_GLOBAL_I18N_ZONE_UTIL_H
 #define OHOS_GLOBAL_I18N_ZONE_UTIL_H
 
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -93,12 +94,72 @@ public:
      * @param retVec used to store the returned timezones
      */
     void GetZoneList(const std::string country, const int32_t offset, std::vector<std::string> &retVec);
+
+    /**
+     * @brief Get the timezone of a country that matches a network time update, such as a NITZ message
+     *
+     * @param country Indicating the country code
+     * @param offset Indicating the total offset from GMT(in milliseconds), daylight saving time included
+     * @param isDST Indicating whether daylight saving time is in effect
+     * @param date Indicating the UTC time(in milliseconds since 1970) that the offset applies to
+     * @return Returns the default timezone of the country if it matches, otherwise the first matching
+     * timezone, or an empty string if no timezone matches.
+     */
+    std::string GetDefaultZone(const std::string &country, const int32_t offset, bool isDST, double date);
+
+    /**
+     * @brief Get the timezones of a country that match a network time update, such as a NITZ message
+     *
+     * @param country Indicating the country code
+     * @param offset Indicating the total offset from GMT(in milliseconds), daylight saving time included
+     * @param isDST Indicating whether daylight saving time is in effect
+     * @param date Indicating the UTC time(in milliseconds since 1970) that the offset applies to
+     * @param retVec used to store the returned timezones
+     */
+    void GetZoneList(const std::string &country, const int32_t offset, bool isDST, double date,
+        std::vector<std::string> &retVec);
 private:
+    struct ZoneInfo {
+        std::string id;
+        int32_t rawOffset;
+        int32_t dstSavings;
+    };
+    // A time range [start, end) during which a zone keeps the same total offset and DST state.
+    struct ZonePeriod {
+        size_t zone;
+        double start;
+        double end;
+    };
     const i18n::phonenumbers::PhoneNumberUtil &phone_util;
     static std::unordered_map<std::string, std::string> defaultMap;
     static bool icuInitialized;
-    static void GetList(icu::StringEnumeration *strEnum, std::vector<std::string> &ret);
-    static void GetString(icu::StringEnumeration *strEnum, std::string &ret);
+    static std::unordered_map<std::string, std::vector<ZoneInfo>> countryZones;
+    static std::once_flag countryZonesFlag;
+    static const std::vector<ZoneInfo> *FindZones(const std::string &country);
+    static void BuildZoneIndex();
+    // Keyed by GetOffsetKey.
+    static std::unordered_map<uint64_t, std::vector<ZonePeriod>> offsetPeriods;
+    static std::once_flag offsetPeriodsFlag;
+    static double periodsStart;
+    static double periodsEnd;
+    static const std::vector<ZoneInfo> *FindZones(const std::string &country, const int32_t offset, bool isDST,
+        double date, std::vector<size_t> &matches);
+    static void BuildOffsetIndex();
+    static void AddZonePeriods(const std::string &country, int32_t countryIndex, size_t zone);
+    static uint64_t GetOffsetKey(int32_t countryIndex, const int32_t offset, bool isDST);
+    // Countries with two letter codes, indexed by GetCountryIndex.
+    static constexpr int32_t COUNTRY_COUNT = 26 * 26;
+    // Stored by GetCallingCodeCountry for calling codes of non geographic entities, whose region is "001".
+    static constexpr int32_t NON_GEO_COUNTRY = COUNTRY_COUNT;
+    // Calling codes have at most three digits.
+    static constexpr int32_t MAX_CALLING_CODE = 1000;
+    static std::vector<std::string> countryDefaults;
+    static std::vector<int16_t> callingCodeCountries;
+    static std::once_flag callingCodesFlag;
+    static int32_t GetCountryIndex(const std::string &country);
+    static int32_t GetCallingCodeCountry(const i18n::phonenumbers::PhoneNumberUtil &phoneUtil, const int32_t number);
+    static void BuildCallingCodeIndex(const i18n::phonenumbers::PhoneNumberUtil &phoneUtil);
+    static void AppendZone(const std::string &id, std::vector<std::string> &retVec, bool checkExisting);
     static bool Init();
 };
 } // namespace I18n